@@ -0,0 +1,131 @@
+"""
+Time snapshotting and restoring a seeded test database, against the JSON
+serialization TransactionTestCase.serialized_rollback otherwise goes
+through.
+
+Two tables are seeded: --rows books, each referring to one of --rows / 10
+authors. The in-tree django.db is used, see intree.py; run it with
+Django 3.0 installed, for instance:
+
+    python benchmarks/db_snapshot.py --engine postgresql --name bench --user postgres
+    python benchmarks/db_snapshot.py --engine sqlite3
+"""
+import argparse
+import time
+from datetime import datetime, timedelta
+
+from intree import use_in_tree_django
+
+use_in_tree_django()
+
+import django  # NOQA isort:skip
+from django.conf import settings  # NOQA isort:skip
+
+
+def timed(label, func):
+    start = time.perf_counter()
+    result = func()
+    print('%-40s %9.2f ms' % (label, (time.perf_counter() - start) * 1000))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--engine', choices=['postgresql', 'sqlite3'], default='postgresql')
+    parser.add_argument('--name', default='bench')
+    parser.add_argument('--user', default='')
+    parser.add_argument('--password', default='')
+    parser.add_argument('--host', default='')
+    parser.add_argument('--port', default='')
+    parser.add_argument('--rows', type=int, default=100000)
+    parser.add_argument('--skip-json', action='store_true', help="don't time the JSON round trip")
+    args = parser.parse_args()
+
+    settings.configure(
+        DATABASES={'default': {
+            'ENGINE': 'django.db.backends.%s' % args.engine,
+            'NAME': args.name,
+            'USER': args.user,
+            'PASSWORD': args.password,
+            'HOST': args.host,
+            'PORT': args.port,
+        }},
+        INSTALLED_APPS=[],
+        USE_TZ=True,
+    )
+    django.setup()
+
+    from django.core import serializers
+    from django.db import connection, models, transaction
+    from django.utils import timezone
+
+    class Author(models.Model):
+        name = models.CharField(max_length=100)
+
+        class Meta:
+            app_label = 'bench'
+
+    class Book(models.Model):
+        title = models.CharField(max_length=200)
+        author = models.ForeignKey(Author, models.CASCADE)
+        published = models.DateTimeField()
+        price = models.DecimalField(max_digits=8, decimal_places=2)
+
+        class Meta:
+            app_label = 'bench'
+
+    creation = connection.creation
+    old_name = connection.settings_dict['NAME']
+    creation.create_test_db(verbosity=0, autoclobber=True, serialize=False)
+    try:
+        with connection.schema_editor() as editor:
+            editor.create_model(Author)
+            editor.create_model(Book)
+
+        authors = max(args.rows // 10, 1)
+        start = timezone.make_aware(datetime(2000, 1, 1))
+        with transaction.atomic():
+            Author.objects.bulk_create(
+                [Author(pk=i + 1, name='Author %d' % i) for i in range(authors)],
+                batch_size=1000,
+            )
+            Book.objects.bulk_create(
+                [
+                    Book(
+                        title='Book %d' % i, author_id=i % authors + 1,
+                        published=start + timedelta(seconds=i), price=i % 10000 / 100,
+                    )
+                    for i in range(args.rows)
+                ],
+                batch_size=1000,
+            )
+        print('%d authors, %d books on %s' % (authors, args.rows, connection.vendor))
+
+        snapshot = timed('snapshot_db()', creation.snapshot_db)
+        if snapshot is None:
+            parser.error("the %s backend doesn't take snapshots" % connection.vendor)
+        Book.objects.all().delete()
+        timed('restore_db_snapshot()', lambda: creation.restore_db_snapshot(snapshot))
+        assert Book.objects.count() == args.rows
+
+        if not args.skip_json:
+            def serialize():
+                return serializers.serialize('json', [*Author.objects.order_by('pk'), *Book.objects.order_by('pk')])
+
+            data = timed('serialize to JSON', serialize)
+            Book.objects.all().delete()
+            Author.objects.all().delete()
+
+            def deserialize():
+                with transaction.atomic():
+                    for obj in serializers.deserialize('json', data):
+                        obj.save()
+
+            timed('deserialize from JSON', deserialize)
+            assert Book.objects.count() == args.rows
+    finally:
+        creation.destroy_test_db(old_name, verbosity=0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,79 @@
+"""
+Make the benchmarks import the code of this repository instead of the
+installed releases. The in-tree code lives under djsqla/ and imports
+itself under its upstream names, but it's a partial tree:
+
+- djsqla/db and djsqla/migrations stand for django.db and
+  django.db.migrations, the rest of django (conf, apps, utils, ...) comes
+  from an installed Django 3.0;
+- djsqla/sqla stands for sqlalchemy, the modules it lacks (schema, types,
+  orm, ...) come from an installed SQLAlchemy 1.4.0b1, the version of the
+  tree.
+
+Modules of the tree take precedence over the installed ones. Call
+use_in_tree_django() or use_in_tree_sqlalchemy() before anything imports
+django.db or sqlalchemy.
+"""
+import importlib.abc
+import importlib.util
+import os
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'djsqla')
+
+
+class OverlayFinder(importlib.abc.MetaPathFinder):
+    """
+    Find the packages under the given {package name: [directory, ...]}
+    roots in the first of the directories holding them, with submodules
+    searched in all of them in order.
+    """
+    def __init__(self, roots):
+        self.roots = roots
+
+    def find_spec(self, fullname, path, target=None):
+        for root in sorted(self.roots, key=len, reverse=True):
+            if fullname == root or fullname.startswith(root + '.'):
+                break
+        else:
+            return None
+        names = fullname[len(root) + 1:].split('.') if fullname != root else []
+        directories = [
+            directory for directory in (os.path.join(base, *names) for base in self.roots[root])
+            if os.path.isfile(os.path.join(directory, '__init__.py'))
+        ]
+        if not directories:
+            # Plain modules are found by the default finders in the
+            # __path__ of their package.
+            return None
+        return importlib.util.spec_from_file_location(
+            fullname, os.path.join(directories[0], '__init__.py'),
+            submodule_search_locations=directories,
+        )
+
+
+def _install(package, roots):
+    if any(name == package or name.startswith(package + '.') for name in sys.modules):
+        raise RuntimeError('%s was imported before the in-tree code was set up.' % package)
+    sys.meta_path.insert(0, OverlayFinder(roots))
+
+
+def _installed_location(package):
+    spec = importlib.util.find_spec(package)
+    if spec is None:
+        raise RuntimeError('%s must be installed.' % package)
+    return spec.submodule_search_locations[0]
+
+
+def use_in_tree_django():
+    installed = os.path.join(_installed_location('django'), 'db')
+    _install('django.db', {
+        'django.db': [os.path.join(ROOT, 'db'), installed],
+        'django.db.migrations': [os.path.join(ROOT, 'migrations'), os.path.join(installed, 'migrations')],
+    })
+
+
+def use_in_tree_sqlalchemy():
+    _install('sqlalchemy', {
+        'sqlalchemy': [os.path.join(ROOT, 'sqla'), _installed_location('sqlalchemy')],
+    })
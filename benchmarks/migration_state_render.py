@@ -0,0 +1,88 @@
+"""
+Time rendering and reloading the models of a synthetic migration state.
+
+The project has one app with --models models: half of them form a
+multi-table inheritance chain, listed subclass first, and the other half a
+tree of foreign keys, each node pointing to its parent. The in-tree
+django.db.migrations is used, see intree.py; run it with Django 3.0
+installed:
+
+    python benchmarks/migration_state_render.py --models 500
+"""
+import argparse
+import time
+
+from intree import use_in_tree_django
+
+use_in_tree_django()
+
+import django  # NOQA isort:skip
+from django.conf import settings  # NOQA isort:skip
+
+
+def build_state(count):
+    from django.db import models
+    from django.db.migrations.state import ModelState, ProjectState
+
+    state = ProjectState()
+    chain = count // 2
+    model_states = [ModelState('bench', 'Chain0', [('id', models.AutoField(primary_key=True))])]
+    for i in range(1, chain):
+        parent = 'bench.Chain%d' % (i - 1)
+        model_states.append(ModelState('bench', 'Chain%d' % i, [
+            ('chain%d_ptr' % (i - 1), models.OneToOneField(
+                parent, models.CASCADE, parent_link=True, primary_key=True,
+                auto_created=True, serialize=False,
+            )),
+        ], bases=(parent,)))
+    # Subclasses first, the worst case for rendering in a single pass.
+    model_states.reverse()
+    model_states.append(ModelState('bench', 'Node0', [('id', models.AutoField(primary_key=True))]))
+    for i in range(1, count - chain):
+        model_states.append(ModelState('bench', 'Node%d' % i, [
+            ('id', models.AutoField(primary_key=True)),
+            ('parent', models.ForeignKey('bench.Node%d' % ((i - 1) // 2), models.CASCADE)),
+        ]))
+    for model_state in model_states:
+        state.add_model(model_state)
+    return state
+
+
+def timed(label, func, repeat):
+    best = float('inf')
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - start)
+    print('%-40s %9.2f ms' % (label, best * 1000))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--models', type=int, default=500)
+    parser.add_argument('--repeat', type=int, default=5)
+    args = parser.parse_args()
+
+    settings.configure(INSTALLED_APPS=[], DATABASES={})
+    django.setup()
+
+    def render():
+        state = build_state(args.models)
+        state.apps
+
+    timed('render %d models' % args.models, render, args.repeat)
+
+    state = build_state(args.models)
+    state.apps
+    last_chain = 'chain%d' % (args.models // 2 - 1)
+    last_node = 'node%d' % (args.models - args.models // 2 - 1)
+    timed('reload chain base', lambda: state.reload_model('bench', 'chain0'), args.repeat)
+    timed('reload chain leaf', lambda: state.reload_model('bench', last_chain), args.repeat)
+    timed('reload tree root', lambda: state.reload_model('bench', 'node0'), args.repeat)
+    timed('reload tree root (delayed)', lambda: state.reload_model('bench', 'node0', delay=True), args.repeat)
+    timed('reload tree leaf', lambda: state.reload_model('bench', last_node), args.repeat)
+    state.clear_delayed_apps_cache()
+
+
+if __name__ == '__main__':
+    main()
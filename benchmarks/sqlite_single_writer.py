@@ -0,0 +1,105 @@
+"""
+Time concurrent single-row inserts into a SQLite file database, through
+contending connections and through the single writer queue of the
+pysqlite dialect.
+
+--threads threads insert --rows rows each. The in-tree sqlalchemy is used,
+see intree.py; run it with Python 3 and SQLAlchemy 1.4.0b1 installed:
+
+    python benchmarks/sqlite_single_writer.py --threads 16 --rows 300
+"""
+import argparse
+import os
+import tempfile
+import threading
+import time
+
+from intree import use_in_tree_sqlalchemy
+
+use_in_tree_sqlalchemy()
+
+from sqlalchemy import Column, Integer, MetaData, String, Table, create_engine  # NOQA isort:skip
+from sqlalchemy.pool import NullPool  # NOQA isort:skip
+
+metadata = MetaData()
+items = Table(
+    'items', metadata,
+    Column('id', Integer, primary_key=True),
+    Column('thread', Integer, nullable=False),
+    Column('data', String(50), nullable=False),
+)
+
+
+def run_threads(count, target):
+    threads = [threading.Thread(target=target, args=(i,)) for i in range(count)]
+    start = time.time()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return time.time() - start
+
+
+def contending(path, args):
+    engine = create_engine(
+        'sqlite:///%s' % path, poolclass=NullPool, connect_args={'timeout': 60},
+    )
+    metadata.create_all(engine)
+
+    def insert(number):
+        for i in range(args.rows):
+            with engine.begin() as conn:
+                conn.execute(items.insert(), {'thread': number, 'data': 'row %d' % i})
+
+    try:
+        return run_threads(args.threads, insert)
+    finally:
+        engine.dispose()
+
+
+def single_writer(path, args):
+    engine = create_engine(
+        'sqlite:///%s' % path, single_writer=True,
+        group_commit_size=args.group_commit_size,
+    )
+    metadata.create_all(engine)
+    write_queue = engine.dialect.write_queue
+
+    def insert(number):
+        for i in range(args.rows):
+            write_queue.execute(items.insert(), {'thread': number, 'data': 'row %d' % i})
+
+    try:
+        elapsed = run_threads(args.threads, insert)
+    finally:
+        write_queue.close()
+        engine.dispose()
+    print('  %d writes in %d commits' % (write_queue.writes, write_queue.commits))
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--threads', type=int, default=16)
+    parser.add_argument('--rows', type=int, default=300)
+    parser.add_argument('--group-commit-size', type=int, default=64)
+    args = parser.parse_args()
+
+    total = args.threads * args.rows
+    for label, bench in [
+        ('contending connections (NullPool)', contending),
+        ('single writer queue', single_writer),
+    ]:
+        directory = tempfile.mkdtemp()
+        path = os.path.join(directory, 'bench.db')
+        try:
+            elapsed = bench(path, args)
+        finally:
+            for name in os.listdir(directory):
+                os.remove(os.path.join(directory, name))
+            os.rmdir(directory)
+        print('%-40s %7.2fs %8.0f writes/s' % (label, elapsed, total / elapsed))
+
+
+if __name__ == '__main__':
+    main()
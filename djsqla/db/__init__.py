@@ -50,6 +50,16 @@ def reset_queries(**kwargs):
 signals.request_started.connect(reset_queries)
 
 
+# Register an event to reset the savepoint counters when a Django request is
+# started.
+def reset_savepoint_counters(**kwargs):
+    for conn in connections.all():
+        conn.savepoints_created = conn.savepoints_elided = 0
+
+
+signals.request_started.connect(reset_savepoint_counters)
+
+
 # Register an event to reset transaction state and close connections past
 # their lifetime.
 def close_old_connections(**kwargs):
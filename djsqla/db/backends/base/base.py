@@ -68,6 +68,13 @@ class BaseDatabaseWrapper:
         self.savepoint_state = 0
         # List of savepoints created by 'atomic'.
         self.savepoint_ids = []
+        # Savepoints of 'atomic' blocks that aren't created until a statement
+        # needs them, in creation order.
+        self.pending_savepoints = []
+        # Savepoints created and savepoints never needed, reset when a Django
+        # request is started.
+        self.savepoints_created = 0
+        self.savepoints_elided = 0
         # Tracks if the outermost 'atomic' block should commit on exit,
         # ie. if autocommit was active on entry.
         self.commit_on_exit = True
@@ -100,6 +107,11 @@ class BaseDatabaseWrapper:
         # call execute(sql, params, many, context).
         self.execute_wrappers = []
 
+        # Statements deferred by Model.save() within transaction.batch_saves()
+        # blocks, and the depth of these blocks.
+        self.write_batch = utils.WriteBatch(self)
+        self.batching_saves = 0
+
         self.client = self.client_class(self)
         self.creation = self.creation_class(self)
         self.features = self.features_class(self)
@@ -186,6 +198,7 @@ class BaseDatabaseWrapper:
         # In case the previous connection was closed while in an atomic block
         self.in_atomic_block = False
         self.savepoint_ids = []
+        self.pending_savepoints = []
         self.needs_rollback = False
         # Reset parameters defining when to close the connection
         max_age = self.settings_dict['CONN_MAX_AGE']
@@ -264,6 +277,7 @@ class BaseDatabaseWrapper:
         """Commit a transaction and reset the dirty flag."""
         self.validate_thread_sharing()
         self.validate_no_atomic_block()
+        self.write_batch.flush()
         self._commit()
         # A successful commit means that the database connection works.
         self.errors_occurred = False
@@ -274,6 +288,7 @@ class BaseDatabaseWrapper:
         """Roll back a transaction and reset the dirty flag."""
         self.validate_thread_sharing()
         self.validate_no_atomic_block()
+        self.write_batch.clear()
         self._rollback()
         # A successful rollback means that the database connection works.
         self.errors_occurred = False
@@ -285,6 +300,7 @@ class BaseDatabaseWrapper:
         """Close the connection to the database."""
         self.validate_thread_sharing()
         self.run_on_commit = []
+        self.write_batch.clear()
 
         # Don't call validate_no_atomic_block() to avoid making it difficult
         # to get rid of a connection in an invalid state. The next connect()
@@ -321,11 +337,14 @@ class BaseDatabaseWrapper:
     # ##### Generic savepoint management methods #####
 
     @async_unsafe
-    def savepoint(self):
+    def savepoint(self, lazy=False):
         """
         Create a savepoint inside the current transaction. Return an
         identifier for the savepoint that will be used for the subsequent
         rollback or commit. Do nothing if savepoints are not supported.
+
+        With lazy=True, the savepoint is only created right before the first
+        statement that needs it, see create_pending_savepoints().
         """
         if not self._savepoint_allowed():
             return
@@ -337,10 +356,48 @@ class BaseDatabaseWrapper:
         sid = "s%s_x%d" % (tid, self.savepoint_state)
 
         self.validate_thread_sharing()
-        self._savepoint(sid)
+        if lazy:
+            self.pending_savepoints.append(sid)
+        else:
+            self._savepoint(sid)
+            self.savepoints_created += 1
 
         return sid
 
+    def needs_savepoint(self, sql):
+        """
+        Return whether the pending savepoints must be created before running
+        sql. Reads don't need them, unless a failed statement aborts the
+        transaction, which only rolling back to a savepoint recovers.
+        """
+        return not (
+            self.features.can_elide_read_only_savepoints and
+            isinstance(sql, str) and sql.lstrip()[:6].upper() == 'SELECT'
+        )
+
+    def create_pending_savepoints(self):
+        """Create the savepoints postponed by savepoint(lazy=True)."""
+        pending_savepoints, self.pending_savepoints = self.pending_savepoints, []
+        for sid in pending_savepoints:
+            self._savepoint(sid)
+            self.savepoints_created += 1
+
+    def elide_savepoint(self, sid, rollback=False):
+        """
+        Forget a savepoint of savepoint(lazy=True) if it hasn't been created,
+        and return whether it was the case. With rollback=True, also remove
+        the callbacks registered while it was active.
+        """
+        if sid not in self.pending_savepoints:
+            return False
+        self.pending_savepoints.remove(sid)
+        self.savepoints_elided += 1
+        if rollback:
+            self.run_on_commit = [
+                (sids, func) for (sids, func) in self.run_on_commit if sid not in sids
+            ]
+        return True
+
     @async_unsafe
     def savepoint_rollback(self, sid):
         """
@@ -12,6 +12,15 @@ from django.db import router
 TEST_DATABASE_PREFIX = 'test_'
 
 
+class DatabaseSnapshot:
+    """
+    Storage-level image of the schema and data of a test database, taken by
+    BaseDatabaseCreation.snapshot_db(). data is backend specific.
+    """
+    def __init__(self, data):
+        self.data = data
+
+
 class BaseDatabaseCreation:
     """
     Encapsulate backend-specific differences pertaining to creation and
@@ -73,14 +82,25 @@ class BaseDatabaseCreation:
                 run_syncdb=True,
             )
 
+        # The cache tables are created before the snapshot below, which must
+        # contain them: SQLite restores the whole database file. As snapshots
+        # cover every table, restoring one also empties the cache tables,
+        # unlike deserializing the JSON of the models.
+        call_command('createcachetable', database=self.connection.alias)
+
         # We then serialize the current state of the database into a string
         # and store it on the connection. This slightly horrific process is so people
         # who are testing on databases without transactions or who are using
         # a TransactionTestCase still get a clean database on every test run.
+        # Backends able to take a snapshot of the database store it instead,
+        # deserialize_db_from_string() restores either.
         if serialize:
-            self.connection._test_serialized_contents = self.serialize_db_to_string()
-
-        call_command('createcachetable', database=self.connection.alias)
+            snapshot = None
+            if not settings.TEST_NON_SERIALIZED_APPS:
+                snapshot = self.snapshot_db()
+            if snapshot is None:
+                snapshot = self.serialize_db_to_string()
+            self.connection._test_serialized_contents = snapshot
 
         # Ensure a connection for the side effect of initializing the test database.
         self.connection.ensure_connection()
@@ -127,12 +147,32 @@ class BaseDatabaseCreation:
     def deserialize_db_from_string(self, data):
         """
         Reload the database with data from a string generated by
-        the serialize_db_to_string() method.
+        the serialize_db_to_string() method, or with a snapshot taken by
+        snapshot_db().
         """
+        if isinstance(data, DatabaseSnapshot):
+            self.restore_db_snapshot(data)
+            return
         data = StringIO(data)
         for obj in serializers.deserialize("json", data, using=self.connection.alias):
             obj.save()
 
+    def snapshot_db(self):
+        """
+        Return a DatabaseSnapshot of the schema and data of the database, or
+        None if the backend doesn't support it. Unlike
+        serialize_db_to_string(), snapshots include every table, and
+        restoring one replaces the whole content of the database.
+        """
+        return None
+
+    def restore_db_snapshot(self, snapshot):
+        """Restore the database to a snapshot taken by snapshot_db()."""
+        raise NotImplementedError(
+            'subclasses of BaseDatabaseCreation that take snapshots must provide '
+            'a restore_db_snapshot() method'
+        )
+
     def _get_database_display_str(self, verbosity, database_name):
         """
         Return display string for a database for use in various actions.
@@ -27,6 +27,9 @@ class BaseDatabaseFeatures:
     has_bulk_insert = True
     uses_savepoints = True
     can_release_savepoints = False
+    # Can the savepoints of atomic blocks that only read be skipped? Not if a
+    # failed statement aborts the transaction.
+    can_elide_read_only_savepoints = False
 
     # If True, don't use integer foreign keys referring to, e.g., positive
     # integer primary keys.
@@ -283,6 +286,15 @@ class BaseDatabaseFeatures:
     # in UPDATE statements to ensure the expression has the correct type?
     requires_casted_case_in_updates = False
 
+    # Does the backend support UPDATE ... FROM joined against a VALUES list?
+    supports_update_from_values = False
+
+    # Does the backend support row value comparisons, (a, b) > (%s, %s)?
+    supports_row_value_comparison = False
+
+    # Does the backend support bulk_create(method='copy')?
+    supports_bulk_copy = False
+
     # Does the backend support partial indexes (CREATE INDEX ... WHERE ...)?
     supports_partial_indexes = True
     supports_functions_in_partial_indexes = True
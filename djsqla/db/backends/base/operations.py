@@ -272,6 +272,39 @@ class BaseDatabaseOperations:
         """
         return None
 
+    def execute_batch(self, cursor, statements):
+        """
+        Execute a sequence of (sql, params) write statements and return the
+        number of rows affected by each. Backends may override this to save
+        round trips.
+        """
+        rowcounts = []
+        for sql, params in statements:
+            cursor.execute(sql, params)
+            rowcounts.append(cursor.rowcount)
+        return rowcounts
+
+    def bound_in_list_sql(self, lhs, values, output_field):
+        """
+        Return the SQL and params of a condition matching lhs, of type
+        output_field, against any of the given prepared values, binding them
+        all as a single parameter so that the SQL doesn't depend on their
+        number. Return None if the backend can't do that for these values.
+        """
+        return None
+
+    def prefetch_batch_size(self):
+        """
+        Return the maximum number of instances whose related objects are
+        fetched by a single prefetch_related() query, or None if there's no
+        limit. Lists of values padded to a power of two must leave room for
+        the other parameters of the query.
+        """
+        max_query_params = self.connection.features.max_query_params
+        if max_query_params is None:
+            return None
+        return 1 << ((max_query_params // 2).bit_length() - 1)
+
     def max_name_length(self):
         """
         Return the maximum length of table and column names, or None if there
@@ -565,6 +598,14 @@ class BaseDatabaseOperations:
         """
         return []
 
+    def get_db_converter_processor(self, converter, expression):
+        """
+        Return a callable taking only the value that's equivalent to calling
+        converter(value, expression, connection), typically a native
+        implementation, or None to call the converter itself.
+        """
+        return None
+
     def convert_durationfield_value(self, value, expression, connection):
         if value is not None:
             return datetime.timedelta(0, 0, value)
@@ -678,5 +719,37 @@ class BaseDatabaseOperations:
     def insert_statement(self, ignore_conflicts=False):
         return 'INSERT INTO'
 
+    def bulk_update_from_values_sql(self, table, pk_column, columns, placeholder_rows):
+        """
+        Return the SQL to update the given columns of table from a VALUES
+        list joined on the primary key. Each row of placeholder_rows holds
+        the placeholder for the primary key followed by one per column.
+        """
+        qn = self.quote_name
+        alias = qn('bulk_update_values')
+        values_sql = ', '.join('(%s)' % ', '.join(row) for row in placeholder_rows)
+        return 'UPDATE %s SET %s FROM (VALUES %s) AS %s (%s) WHERE %s.%s = %s.%s' % (
+            qn(table),
+            ', '.join('%s = %s.%s' % (qn(column), alias, qn(column)) for column in columns),
+            values_sql,
+            alias,
+            ', '.join(qn(column) for column in [pk_column, *columns]),
+            qn(table), qn(pk_column), alias, qn(pk_column),
+        )
+
     def ignore_conflicts_suffix_sql(self, ignore_conflicts=None):
         return ''
+
+    def estimate_table_rows(self, cursor, table_name):
+        """
+        Return the number of rows of table_name estimated from the statistics
+        of the database, or None if there are none.
+        """
+        return None
+
+    def estimate_query_rows(self, cursor, sql, params):
+        """
+        Return the number of rows the query planner expects the query to
+        return, or None if it doesn't tell.
+        """
+        return None
@@ -1,4 +1,5 @@
 import logging
+from contextlib import contextmanager
 from datetime import datetime
 
 from django.db.backends.ddl_references import (
@@ -116,6 +117,19 @@ class BaseDatabaseSchemaEditor:
         if self.atomic_migration:
             self.atomic.__exit__(exc_type, exc_value, traceback)
 
+    @contextmanager
+    def batch_alter(self):
+        """
+        Group the alterations made in the block. Backends that rebuild tables
+        to alter them may delay the rebuilds until flush_batch() or the end
+        of the block, rebuilding each table once.
+        """
+        yield
+
+    def flush_batch(self):
+        """Run the alterations delayed by batch_alter(), if any."""
+        pass
+
     # Core utility functions
 
     def execute(self, sql, params=()):
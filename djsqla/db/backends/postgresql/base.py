@@ -14,6 +14,7 @@ from django.db import connections
 from django.db.backends.base.base import BaseDatabaseWrapper
 from django.db.backends.utils import (
     CursorDebugWrapper as BaseCursorDebugWrapper,
+    CursorWrapper as BaseCursorWrapper,
 )
 from django.db.utils import DatabaseError as WrappedDatabaseError
 from django.utils.asyncio import async_unsafe
@@ -314,15 +315,45 @@ class DatabaseWrapper(BaseDatabaseWrapper):
         with self.temporary_connection():
             return self.connection.server_version
 
+    def make_cursor(self, cursor):
+        return CursorWrapper(cursor, self)
+
     def make_debug_cursor(self, cursor):
         return CursorDebugWrapper(cursor, self)
 
 
-class CursorDebugWrapper(BaseCursorDebugWrapper):
+class CursorWrapper(BaseCursorWrapper):
+    # COPY statements run through these methods instead of execute(), but
+    # need pending savepoints and batched writes handled all the same.
+
     def copy_expert(self, sql, file, *args):
-        with self.debug_sql(sql):
+        self._prepare_statement(sql)
+        self.db.validate_no_broken_transaction()
+        with self.db.wrap_database_errors:
             return self.cursor.copy_expert(sql, file, *args)
 
+    def copy_from(self, file, table, *args, **kwargs):
+        self._prepare_statement('COPY %s FROM STDIN' % table)
+        self.db.validate_no_broken_transaction()
+        with self.db.wrap_database_errors:
+            return self.cursor.copy_from(file, table, *args, **kwargs)
+
     def copy_to(self, file, table, *args, **kwargs):
-        with self.debug_sql(sql='COPY %s TO STDOUT' % table):
+        self._prepare_statement('COPY %s TO STDOUT' % table)
+        self.db.validate_no_broken_transaction()
+        with self.db.wrap_database_errors:
             return self.cursor.copy_to(file, table, *args, **kwargs)
+
+
+class CursorDebugWrapper(BaseCursorDebugWrapper, CursorWrapper):
+    def copy_expert(self, sql, file, *args):
+        with self.debug_sql(sql):
+            return super().copy_expert(sql, file, *args)
+
+    def copy_from(self, file, table, *args, **kwargs):
+        with self.debug_sql(sql='COPY %s FROM STDIN' % table):
+            return super().copy_from(file, table, *args, **kwargs)
+
+    def copy_to(self, file, table, *args, **kwargs):
+        with self.debug_sql(sql='COPY %s TO STDOUT' % table):
+            return super().copy_to(file, table, *args, **kwargs)
@@ -0,0 +1,264 @@
+"""
+Encoder for the binary format of PostgreSQL's COPY FROM STDIN, used by
+QuerySet.bulk_create(method='copy').
+
+The stream is a header, one tuple per row and a trailer. A tuple is the
+number of fields as an int16 followed by each field as an int32 length (-1
+for NULL) and the value in the type's binary send format. See
+https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+"""
+import datetime
+import decimal
+import struct
+from itertools import islice
+
+SIGNATURE = b'PGCOPY\n\xff\r\n\x00'
+# Signature, flags and header extension length.
+HEADER = SIGNATURE + struct.pack('!ii', 0, 0)
+TRAILER = struct.pack('!h', -1)
+
+# Type codes understood by CopyBinaryEncoder.
+(
+    BOOL, INT2, INT4, INT8, FLOAT4, FLOAT8, TEXT, BYTEA, DATE, TIME,
+    TIMESTAMP, INTERVAL, NUMERIC, UUID, TIMESTAMP_NAIVE,
+) = range(15)
+
+# Column types, without their modifiers, mapped to type codes. Values of
+# timestamp with time zone columns are sent as UTC, those of timestamp
+# columns as their wall-clock time, like PostgreSQL casts them from text.
+DB_TYPE_CODES = {
+    'boolean': BOOL,
+    'smallint': INT2,
+    'smallserial': INT2,
+    'integer': INT4,
+    'serial': INT4,
+    'bigint': INT8,
+    'bigserial': INT8,
+    'real': FLOAT4,
+    'double precision': FLOAT8,
+    'varchar': TEXT,
+    'text': TEXT,
+    'bytea': BYTEA,
+    'date': DATE,
+    'time': TIME,
+    'timestamp': TIMESTAMP_NAIVE,
+    'timestamp without time zone': TIMESTAMP_NAIVE,
+    'timestamp with time zone': TIMESTAMP,
+    'interval': INTERVAL,
+    'numeric': NUMERIC,
+    'uuid': UUID,
+}
+
+# Number of rows encoded at a time by default.
+CHUNK_SIZE = 1000
+
+NULL = struct.pack('!i', -1)
+POSTGRES_EPOCH = datetime.datetime(2000, 1, 1)
+POSTGRES_EPOCH_DATE_ORDINAL = POSTGRES_EPOCH.toordinal()
+NUMERIC_POS = 0x0000
+NUMERIC_NEG = 0x4000
+NUMERIC_NAN = 0xC000
+
+
+def get_type_code(db_type):
+    """
+    Return the type code for a column type as returned by Field.db_type(),
+    or None if it can't be sent in binary format.
+    """
+    if db_type is None:
+        return None
+    return DB_TYPE_CODES.get(db_type.split('(')[0].strip())
+
+
+def _microseconds(delta):
+    return (delta.days * 86400 + delta.seconds) * 1000000 + delta.microseconds
+
+
+def _encode_bool(value):
+    return struct.pack('!i?', 1, bool(value))
+
+
+def _encode_int2(value):
+    return struct.pack('!ih', 2, value)
+
+
+def _encode_int4(value):
+    return struct.pack('!ii', 4, value)
+
+
+def _encode_int8(value):
+    return struct.pack('!iq', 8, value)
+
+
+def _encode_float4(value):
+    return struct.pack('!if', 4, value)
+
+
+def _encode_float8(value):
+    return struct.pack('!id', 8, value)
+
+
+def _encode_text(value):
+    if not isinstance(value, str):
+        value = str(value)
+    value = value.encode()
+    return struct.pack('!i', len(value)) + value
+
+
+def _encode_bytea(value):
+    value = bytes(value)
+    return struct.pack('!i', len(value)) + value
+
+
+def _encode_date(value):
+    return struct.pack('!ii', 4, value.toordinal() - POSTGRES_EPOCH_DATE_ORDINAL)
+
+
+def _encode_time(value):
+    return struct.pack('!iq', 8, ((value.hour * 60 + value.minute) * 60 + value.second) * 1000000 + value.microsecond)
+
+
+def _encode_timestamp(value):
+    if value.tzinfo is not None:
+        value = value.replace(tzinfo=None) - value.utcoffset()
+    return struct.pack('!iq', 8, _microseconds(value - POSTGRES_EPOCH))
+
+
+def _encode_timestamp_naive(value):
+    return struct.pack('!iq', 8, _microseconds(value.replace(tzinfo=None) - POSTGRES_EPOCH))
+
+
+def _encode_interval(value):
+    # Microseconds, days and months. Everything is kept in the first part so
+    # that the interval is exactly the timedelta.
+    return struct.pack('!iqii', 16, _microseconds(value), 0, 0)
+
+
+def _encode_numeric(value):
+    if not isinstance(value, decimal.Decimal):
+        value = decimal.Decimal(value)
+    sign, digits, exponent = value.as_tuple()
+    if not isinstance(exponent, int):
+        if value.is_nan():
+            return struct.pack('!ihhHh', 8, 0, 0, NUMERIC_NAN, 0)
+        raise ValueError('Cannot encode %r as numeric.' % value)
+    dscale = max(-exponent, 0)
+    if exponent > 0:
+        digits += (0,) * exponent
+        exponent = 0
+    # Pad the fractional part on the right and the integer part on the left
+    # so that both split into groups of four decimal digits.
+    digits += (0,) * (exponent % 4)
+    fraction_length = -exponent + exponent % 4
+    integer_length = len(digits) - fraction_length
+    if integer_length < 0:
+        digits = (0,) * -integer_length + digits
+        integer_length = 0
+    digits = (0,) * (-integer_length % 4) + digits
+    integer_length += -integer_length % 4
+    groups = [
+        digits[i] * 1000 + digits[i + 1] * 100 + digits[i + 2] * 10 + digits[i + 3]
+        for i in range(0, len(digits), 4)
+    ]
+    weight = integer_length // 4 - 1
+    start, end = 0, len(groups)
+    while start < end and groups[start] == 0:
+        start += 1
+        weight -= 1
+    while end > start and groups[end - 1] == 0:
+        end -= 1
+    groups = groups[start:end]
+    if not groups:
+        weight = 0
+    return struct.pack(
+        '!ihhHh%dH' % len(groups), 8 + 2 * len(groups), len(groups), weight,
+        NUMERIC_NEG if sign else NUMERIC_POS, dscale, *groups
+    )
+
+
+def _encode_uuid(value):
+    return struct.pack('!i', 16) + value.bytes
+
+
+ENCODERS = {
+    BOOL: _encode_bool,
+    INT2: _encode_int2,
+    INT4: _encode_int4,
+    INT8: _encode_int8,
+    FLOAT4: _encode_float4,
+    FLOAT8: _encode_float8,
+    TEXT: _encode_text,
+    BYTEA: _encode_bytea,
+    DATE: _encode_date,
+    TIME: _encode_time,
+    TIMESTAMP: _encode_timestamp,
+    INTERVAL: _encode_interval,
+    NUMERIC: _encode_numeric,
+    UUID: _encode_uuid,
+    TIMESTAMP_NAIVE: _encode_timestamp_naive,
+}
+
+
+try:
+    from sqlalchemy.cpgcopy import CopyBinaryEncoder
+except ImportError:
+    class CopyBinaryEncoder:
+        """
+        Encode rows of values into binary COPY tuples, given the type code of
+        each column.
+        """
+        def __init__(self, type_codes):
+            self.type_codes = tuple(type_codes)
+            self._encoders = [ENCODERS[code] for code in self.type_codes]
+            self._field_count = struct.pack('!h', len(self.type_codes))
+
+        def encode(self, rows):
+            """Return the tuples for the given rows as a bytes object."""
+            encoders = self._encoders
+            field_count = self._field_count
+            parts = []
+            for row in rows:
+                if len(row) != len(encoders):
+                    raise ValueError(
+                        'Expected %d values in row, got %d.' % (len(encoders), len(row))
+                    )
+                parts.append(field_count)
+                for encode, value in zip(encoders, row):
+                    parts.append(NULL if value is None else encode(value))
+            return b''.join(parts)
+
+
+def iter_copy_data(encoder, rows, chunk_size):
+    """
+    Yield the complete COPY stream for rows, encoding chunk_size rows at a
+    time so that memory use is bounded by the chunk size.
+    """
+    yield HEADER
+    rows = iter(rows)
+    for chunk in iter(lambda: list(islice(rows, chunk_size)), []):
+        yield encoder.encode(chunk)
+    yield TRAILER
+
+
+class CopyDataReader:
+    """
+    File-like object reading from an iterable of bytes objects, as expected
+    by cursor.copy_expert().
+    """
+    def __init__(self, chunks):
+        self._chunks = iter(chunks)
+        self._buffer = memoryview(b'')
+        self._offset = 0
+
+    def read(self, size=-1):
+        if self._offset == len(self._buffer):
+            self._buffer = memoryview(next(self._chunks, b''))
+            self._offset = 0
+        if size is None or size < 0:
+            parts = [self._buffer[self._offset:].tobytes()]
+            parts.extend(self._chunks)
+            self._buffer, self._offset = memoryview(b''), 0
+            return b''.join(parts)
+        data = self._buffer[self._offset:self._offset + size].tobytes()
+        self._offset += len(data)
+        return data
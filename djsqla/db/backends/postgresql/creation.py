@@ -1,8 +1,12 @@
 import sys
+from io import BytesIO
 
 from psycopg2 import errorcodes
 
-from django.db.backends.base.creation import BaseDatabaseCreation
+from django.db import transaction
+from django.db.backends.base.creation import (
+    BaseDatabaseCreation, DatabaseSnapshot,
+)
 from django.db.backends.utils import strip_quotes
 
 
@@ -75,3 +79,43 @@ class DatabaseCreation(BaseDatabaseCreation):
                 except Exception as e:
                     self.log('Got an error cloning the test database: %s' % e)
                     sys.exit(2)
+
+    def snapshot_db(self):
+        """
+        Dump every table with COPY in binary format, along with the state of
+        the sequences.
+        """
+        tables = []
+        sequences = []
+        with self.connection.cursor() as cursor:
+            for table_name in self.connection.introspection.table_names(cursor):
+                data = BytesIO()
+                cursor.copy_expert('COPY %s TO STDOUT (FORMAT binary)' % self._quote_name(table_name), data)
+                tables.append((table_name, data.getvalue()))
+            cursor.execute("""
+                SELECT c.relname
+                FROM pg_catalog.pg_class c
+                WHERE c.relkind = 'S' AND pg_catalog.pg_table_is_visible(c.oid)
+            """)
+            for sequence_name, in cursor.fetchall():
+                cursor.execute('SELECT last_value, is_called FROM %s' % self._quote_name(sequence_name))
+                sequences.append((sequence_name, *cursor.fetchone()))
+        return DatabaseSnapshot((tables, sequences))
+
+    def restore_db_snapshot(self, snapshot):
+        """
+        Truncate the tables and copy their rows back. Deferrable constraints
+        are deferred, so they're only checked once every table is restored.
+        """
+        tables, sequences = snapshot.data
+        with transaction.atomic(using=self.connection.alias), self.connection.cursor() as cursor:
+            cursor.execute('SET CONSTRAINTS ALL DEFERRED')
+            if tables:
+                cursor.execute('TRUNCATE %s' % ', '.join(self._quote_name(table_name) for table_name, _ in tables))
+            for table_name, data in tables:
+                cursor.copy_expert('COPY %s FROM STDIN (FORMAT binary)' % self._quote_name(table_name), BytesIO(data))
+            for sequence_name, last_value, is_called in sequences:
+                cursor.execute(
+                    'SELECT setval(%s, %s, %s)',
+                    [self._quote_name(sequence_name), last_value, is_called],
+                )
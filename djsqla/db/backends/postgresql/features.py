@@ -51,6 +51,9 @@ class DatabaseFeatures(BaseDatabaseFeatures):
         END;
     $$ LANGUAGE plpgsql;"""
     requires_casted_case_in_updates = True
+    supports_update_from_values = True
+    supports_row_value_comparison = True
+    supports_bulk_copy = True
     supports_over_clause = True
     supports_aggregate_filter_clause = True
     supported_explain_formats = {'JSON', 'TEXT', 'XML', 'YAML'}
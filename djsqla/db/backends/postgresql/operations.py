@@ -1,8 +1,16 @@
+import datetime
+import decimal
+import json
+import uuid
+
+import pytz
 from psycopg2.extras import Inet
 
 from django.conf import settings
 from django.db import NotSupportedError
 from django.db.backends.base.operations import BaseDatabaseOperations
+from django.db.backends.postgresql import binarycopy
+from django.utils import timezone
 
 
 class DatabaseOperations(BaseDatabaseOperations):
@@ -253,6 +261,111 @@ class DatabaseOperations(BaseDatabaseOperations):
         values_sql = ", ".join("(%s)" % sql for sql in placeholder_rows_sql)
         return "VALUES " + values_sql
 
+    # Each statement of a batch appends its rowcount to a transaction-local
+    # setting so that a single round trip reports all of them.
+    batch_reset_sql = b"SELECT set_config('django.batch_rowcounts', '', true)"
+    batch_statement_sql = (
+        b"WITH batch_rows AS (%s RETURNING 1) "
+        b"SELECT set_config('django.batch_rowcounts', "
+        b"current_setting('django.batch_rowcounts') || ' ' || count(*), true) "
+        b"FROM batch_rows"
+    )
+    batch_result_sql = b"SELECT current_setting('django.batch_rowcounts')"
+    batch_page_size = 100
+
+    def execute_batch(self, cursor, statements):
+        """
+        Send the statements, which must be INSERT, UPDATE or DELETE without a
+        RETURNING clause, batch_page_size at a time in one round trip.
+        """
+        rowcounts = []
+        for offset in range(0, len(statements), self.batch_page_size):
+            parts = [self.batch_reset_sql]
+            parts.extend(
+                self.batch_statement_sql % cursor.mogrify(sql, params)
+                for sql, params in statements[offset:offset + self.batch_page_size]
+            )
+            parts.append(self.batch_result_sql)
+            cursor.execute(b';'.join(parts))
+            rowcounts.extend(int(rowcount) for rowcount in cursor.fetchone()[0].split())
+        return rowcounts
+
+    # Types of values whose str() is accepted as an element of an array
+    # literal of the column type.
+    array_literal_types = (
+        str, int, float, decimal.Decimal, uuid.UUID, datetime.date, datetime.time,
+    )
+
+    def bound_in_list_sql(self, lhs, values, output_field):
+        # psycopg2 adapts lists to ARRAY[...] constructors, whose SQL still
+        # depends on the number of values, so bind an array literal instead.
+        if any(type(value) is bool or not isinstance(value, self.array_literal_types) for value in values):
+            return None
+        db_type = output_field.cast_db_type(self.connection)
+        if db_type is None:
+            return None
+        literal = '{%s}' % ','.join(
+            '"%s"' % str(value).replace('\\', '\\\\').replace('"', '\\"')
+            for value in values
+        )
+        return '%s = ANY(%%s::%s[])' % (lhs, db_type), [literal]
+
+    def allocate_sequence_values_sql(self, table, column):
+        """
+        Return the SQL fetching %s values from the sequence of table.column,
+        one per row.
+        """
+        return "SELECT nextval(pg_get_serial_sequence('%s','%s')) FROM generate_series(1, %%s)" % (
+            self.quote_name(table), column,
+        )
+
+    def bulk_copy_sql(self, table, columns):
+        return 'COPY %s (%s) FROM STDIN WITH (FORMAT binary)' % (
+            self.quote_name(table), ', '.join(self.quote_name(column) for column in columns),
+        )
+
+    def bulk_copy(self, cursor, table, fields, rows, chunk_size=None):
+        """
+        Stream rows into table with COPY ... FROM STDIN in binary format.
+        rows is an iterable of lists of values prepared for saving, in the
+        order of fields. Only chunk_size rows are encoded at a time.
+        """
+        type_codes = []
+        for field in fields:
+            type_code = binarycopy.get_type_code(field.db_type(self.connection))
+            if type_code is None:
+                raise NotSupportedError(
+                    "%s can't be inserted with bulk_create(method='copy')." % field
+                )
+            type_codes.append(type_code)
+        if not settings.USE_TZ:
+            # Binary timestamps are UTC, while naive values are meant in the
+            # connection's time zone.
+            rows = self._localize_naive_datetimes(rows, type_codes)
+        data = binarycopy.iter_copy_data(
+            binarycopy.CopyBinaryEncoder(type_codes), rows, chunk_size or binarycopy.CHUNK_SIZE,
+        )
+        with self.connection.wrap_database_errors:
+            cursor.copy_expert(
+                self.bulk_copy_sql(table, [field.column for field in fields]),
+                binarycopy.CopyDataReader(data),
+            )
+
+    def _localize_naive_datetimes(self, rows, type_codes):
+        positions = [i for i, type_code in enumerate(type_codes) if type_code == binarycopy.TIMESTAMP]
+        if not positions:
+            return rows
+        tz = pytz.timezone(self.connection.timezone_name)
+
+        def localize(rows):
+            for row in rows:
+                for i in positions:
+                    value = row[i]
+                    if value is not None and timezone.is_naive(value):
+                        row[i] = timezone.make_aware(value, tz)
+                yield row
+        return localize(rows)
+
     def adapt_datefield_value(self, value):
         return value
 
@@ -299,3 +412,29 @@ class DatabaseOperations(BaseDatabaseOperations):
 
     def ignore_conflicts_suffix_sql(self, ignore_conflicts=None):
         return 'ON CONFLICT DO NOTHING' if ignore_conflicts else super().ignore_conflicts_suffix_sql(ignore_conflicts)
+
+    def estimate_table_rows(self, cursor, table_name):
+        # Scale reltuples to the current size of the table like the planner
+        # does. It's -1 until the table is first vacuumed or analyzed.
+        cursor.execute(
+            """
+            SELECT CASE WHEN relpages > 0
+                THEN reltuples / relpages * (pg_relation_size(oid) / current_setting('block_size')::integer)
+                ELSE reltuples
+            END
+            FROM pg_class
+            WHERE oid = to_regclass(%s)
+            """,
+            [self.quote_name(table_name)],
+        )
+        row = cursor.fetchone()
+        if row is None or row[0] < 0:
+            return None
+        return int(row[0])
+
+    def estimate_query_rows(self, cursor, sql, params):
+        cursor.execute('%s %s' % (self.explain_query_prefix('JSON'), sql), params)
+        plan = cursor.fetchone()[0]
+        if isinstance(plan, str):
+            plan = json.loads(plan)
+        return int(plan[0]['Plan']['Plan Rows'])
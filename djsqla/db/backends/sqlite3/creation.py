@@ -2,8 +2,11 @@ import os
 import shutil
 import sys
 from pathlib import Path
+from sqlite3 import dbapi2 as Database
 
-from django.db.backends.base.creation import BaseDatabaseCreation
+from django.db.backends.base.creation import (
+    BaseDatabaseCreation, DatabaseSnapshot,
+)
 
 
 class DatabaseCreation(BaseDatabaseCreation):
@@ -86,6 +89,38 @@ class DatabaseCreation(BaseDatabaseCreation):
             # Remove the SQLite database file
             os.remove(test_database_name)
 
+    def snapshot_db(self):
+        """
+        Copy the database with the online backup API. On Python 3.11+ the
+        image is kept as bytes, otherwise in a private in-memory database.
+        """
+        self.connection.ensure_connection()
+        if not hasattr(self.connection.connection, 'backup'):
+            # Python < 3.7.
+            return None
+        with self.connection.wrap_database_errors:
+            if hasattr(self.connection.connection, 'serialize'):
+                return DatabaseSnapshot(self.connection.connection.serialize())
+            image = Database.connect(':memory:', check_same_thread=False)
+            self.connection.connection.backup(image)
+        return DatabaseSnapshot(image)
+
+    def restore_db_snapshot(self, snapshot):
+        self.connection.ensure_connection()
+        if self.connection.in_atomic_block:
+            raise RuntimeError("Can't restore a database snapshot inside a transaction.")
+        with self.connection.wrap_database_errors:
+            image = snapshot.data
+            if isinstance(image, bytes):
+                image = Database.connect(':memory:')
+                try:
+                    image.deserialize(snapshot.data)
+                    image.backup(self.connection.connection)
+                finally:
+                    image.close()
+            else:
+                image.backup(self.connection.connection)
+
     def test_db_signature(self):
         """
         Return a tuple that uniquely identifies a test database.
@@ -1,4 +1,6 @@
+from django.db import OperationalError
 from django.db.backends.base.features import BaseDatabaseFeatures
+from django.utils.functional import cached_property
 
 from .base import Database
 
@@ -33,8 +35,12 @@ class DatabaseFeatures(BaseDatabaseFeatures):
     supports_cast_with_precision = False
     time_cast_precision = 3
     can_release_savepoints = True
+    can_elide_read_only_savepoints = True
     # Is "ALTER TABLE ... RENAME COLUMN" supported?
     can_alter_table_rename_column = Database.sqlite_version_info >= (3, 25, 0)
+    # Is "ALTER TABLE ... DROP COLUMN" supported? 3.35.0 to 3.35.4 could
+    # corrupt the database.
+    can_alter_table_drop_column = Database.sqlite_version_info >= (3, 35, 5)
     supports_parentheses_in_compound = False
     # Deferred constraint checks can be emulated on SQLite < 3.20 but not in a
     # reasonably performant way.
@@ -45,3 +51,15 @@ class DatabaseFeatures(BaseDatabaseFeatures):
     supports_frame_range_fixed_distance = Database.sqlite_version_info >= (3, 28, 0)
     supports_aggregate_filter_clause = Database.sqlite_version_info >= (3, 30, 1)
     supports_order_by_nulls_modifier = Database.sqlite_version_info >= (3, 30, 0)
+    supports_update_from_values = Database.sqlite_version_info >= (3, 33, 0)
+    supports_row_value_comparison = Database.sqlite_version_info >= (3, 15, 0)
+
+    @cached_property
+    def supports_json_each(self):
+        """Is the JSON1 extension, and so json_each(), available?"""
+        with self.connection.cursor() as cursor:
+            try:
+                cursor.execute("SELECT value FROM json_each('[]')")
+            except OperationalError:
+                return False
+        return True
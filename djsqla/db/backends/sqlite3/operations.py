@@ -1,5 +1,6 @@
 import datetime
 import decimal
+import json
 import uuid
 from functools import lru_cache
 from itertools import chain
@@ -15,6 +16,11 @@ from django.utils.dateparse import parse_date, parse_datetime, parse_time
 from django.utils.duration import duration_microseconds
 from django.utils.functional import cached_property
 
+try:
+    from sqlalchemy.cprocessors import int_to_boolean
+except ImportError:
+    int_to_boolean = None
+
 
 class DatabaseOperations(BaseDatabaseOperations):
     cast_char_field_without_max_length = 'text'
@@ -39,6 +45,30 @@ class DatabaseOperations(BaseDatabaseOperations):
         else:
             return len(objs)
 
+    def bound_in_list_sql(self, lhs, values):
+        if not self.connection.features.supports_json_each:
+            return None
+        if not all(type(value) in (int, str) for value in values):
+            return None
+        return '%s IN (SELECT value FROM json_each(%%s))' % lhs, [json.dumps(list(values))]
+
+    def prefetch_batch_size(self):
+        if self.connection.features.supports_json_each:
+            return None
+        return super().prefetch_batch_size()
+
+    def estimate_table_rows(self, cursor, table_name):
+        # ANALYZE stores the number of rows of the table as the first
+        # integer of its sqlite_stat1 entries, one per index (or a single
+        # one with a NULL idx for tables without indexes). Partial indexes
+        # count fewer rows.
+        cursor.execute("SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'sqlite_stat1'")
+        if cursor.fetchone() is None:
+            return None
+        cursor.execute('SELECT stat FROM sqlite_stat1 WHERE tbl = %s', [table_name])
+        counts = [int(stat.split(None, 1)[0]) for stat, in cursor.fetchall() if stat]
+        return max(counts) if counts else None
+
     def check_expression_support(self, expression):
         bad_fields = (fields.DateField, fields.DateTimeField, fields.TimeField)
         bad_aggregates = (aggregates.Sum, aggregates.Avg, aggregates.Variance, aggregates.StdDev)
@@ -254,6 +284,16 @@ class DatabaseOperations(BaseDatabaseOperations):
             converters.append(self.convert_booleanfield_value)
         return converters
 
+    def get_db_converter_processor(self, converter, expression):
+        # Boolean columns only ever hold 0, 1 or NULL, for which the native
+        # processor matches convert_booleanfield_value(). The date, time,
+        # decimal and UUID converters accept more input formats than their
+        # native counterparts and so aren't substituted.
+        if (int_to_boolean is not None and isinstance(expression, Col) and
+                converter == self.convert_booleanfield_value):
+            return int_to_boolean
+        return super().get_db_converter_processor(converter, expression)
+
     def convert_datetimefield_value(self, value, expression, connection):
         if value is not None:
             if not isinstance(value, datetime.datetime):
@@ -304,6 +344,22 @@ class DatabaseOperations(BaseDatabaseOperations):
             for row in placeholder_rows
         )
 
+    def bulk_update_from_values_sql(self, table, pk_column, columns, placeholder_rows):
+        # SQLite can't name the columns of a VALUES subquery, but it can name
+        # those of a common table expression.
+        qn = self.quote_name
+        alias = qn('bulk_update_values')
+        values_sql = ', '.join('(%s)' % ', '.join(row) for row in placeholder_rows)
+        return 'WITH %s (%s) AS (VALUES %s) UPDATE %s SET %s FROM %s WHERE %s.%s = %s.%s' % (
+            alias,
+            ', '.join(qn(column) for column in [pk_column, *columns]),
+            values_sql,
+            qn(table),
+            ', '.join('%s = %s.%s' % (qn(column), alias, qn(column)) for column in columns),
+            alias,
+            qn(table), qn(pk_column), alias, qn(pk_column),
+        )
+
     def combine_expression(self, connector, sub_expressions):
         # SQLite doesn't have a ^ operator, so use the user-defined POWER
         # function that's registered in connect().
@@ -1,5 +1,7 @@
 import copy
+from contextlib import contextmanager
 from decimal import Decimal
+from itertools import chain
 
 from django.apps.registry import Apps
 from django.db.backends.base.schema import BaseDatabaseSchemaEditor
@@ -15,8 +17,15 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
     sql_delete_table = "DROP TABLE %(table)s"
     sql_create_fk = None
     sql_create_inline_fk = "REFERENCES %(to_table)s (%(to_column)s) DEFERRABLE INITIALLY DEFERRED"
+    sql_create_column_inline_fk = sql_create_inline_fk
     sql_create_unique = "CREATE UNIQUE INDEX %(name)s ON %(table)s (%(columns)s)"
     sql_delete_unique = "DROP INDEX %(name)s"
+    sql_delete_column = "ALTER TABLE %(table)s DROP COLUMN %(column)s"
+
+    # Depth of batch_alter() blocks, and arguments of the table rebuild they
+    # delay: (model, create_field, delete_field, alter_field, mapping).
+    _batch_depth = 0
+    _deferred_remake = None
 
     def __enter__(self):
         # Some SQLite schema alterations need foreign key constraints to be
@@ -32,10 +41,56 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
         return super().__enter__()
 
     def __exit__(self, exc_type, exc_value, traceback):
+        if exc_type is None:
+            self.flush_batch()
+        else:
+            self._deferred_remake = None
         self.connection.check_constraints()
         super().__exit__(exc_type, exc_value, traceback)
         self.connection.enable_constraint_checking()
 
+    @contextmanager
+    def batch_alter(self):
+        """
+        Delay table rebuilds until a statement is executed or the block ends,
+        so that consecutive alterations of a table rebuild it once. Only done
+        when the rebuilds are rolled back with the rest of the migration.
+        """
+        if not self.atomic_migration:
+            yield
+            return
+        self._batch_depth += 1
+        try:
+            yield
+        except BaseException:
+            self._batch_depth -= 1
+            self._deferred_remake = None
+            raise
+        self._batch_depth -= 1
+        if not self._batch_depth:
+            self.flush_batch()
+
+    def flush_batch(self):
+        if self._deferred_remake is not None:
+            model, create_field, delete_field, alter_field, mapping = self._deferred_remake
+            self._deferred_remake = None
+            self._remake_table(model, create_field, delete_field, alter_field, copy_mapping=mapping)
+
+    def _has_deferred_remake(self, model):
+        return (
+            self._deferred_remake is not None and
+            self._deferred_remake[0]._meta.db_table == model._meta.db_table
+        )
+
+    def execute(self, sql, params=()):
+        # Statements see the tables as altered so far.
+        self.flush_batch()
+        super().execute(sql, params)
+
+    def _constraint_names(self, *args, **kwargs):
+        self.flush_batch()
+        return super()._constraint_names(*args, **kwargs)
+
     def quote_value(self, value):
         # The backend "mostly works" without this function and there are use
         # cases for compiling Python without the sqlite3 libraries (e.g.
@@ -71,6 +126,7 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
         column are considered. If `ignore_self` is True, self-referential
         constraints are ignored.
         """
+        self.flush_batch()
         with self.connection.cursor() as cursor:
             for other_table in self.connection.introspection.get_table_list(cursor):
                 if ignore_self and other_table.name == table_name:
@@ -137,7 +193,7 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
         else:
             super().alter_field(model, old_field, new_field, strict=strict)
 
-    def _remake_table(self, model, create_field=None, delete_field=None, alter_field=None):
+    def _remake_table(self, model, create_field=None, delete_field=None, alter_field=None, copy_mapping=None):
         """
         Shortcut to transform a model from old_model into new_model
 
@@ -152,7 +208,15 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
           3. Drop the "app_model" table
           4. Rename the "new__app_model" table to "app_model"
           5. Restore any index of the previous "app_model" table.
+
+        Inside batch_alter(), the rebuild is delayed and merged with the
+        following rebuilds of the same table. copy_mapping is then the
+        mapping of the merged rebuild, to copy the data from the table as it
+        was before the first of them.
         """
+        deferring = copy_mapping is None and self._batch_depth
+        if deferring and self._deferred_remake is not None and not self._has_deferred_remake(model):
+            self.flush_batch()
         # Self-referential fields must be recreated rather than copied from
         # the old model to ensure their remote_field.field_name doesn't refer
         # to an altered field.
@@ -163,9 +227,10 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
             f.name: f.clone() if is_self_referential(f) else f
             for f in model._meta.local_concrete_fields
         }
-        # Since mapping might mix column names and default values,
-        # its values must be already quoted.
-        mapping = {f.column: self.quote_name(f.column) for f in model._meta.local_concrete_fields}
+        # Since mapping might mix column names and default values, its values
+        # are lists of SQL snippets and (column,) references to the columns
+        # of the existing table.
+        mapping = {f.column: [(f.column,)] for f in model._meta.local_concrete_fields}
         # This maps field names (not columns) for things like unique_together
         rename_mapping = {}
         # If any of the new or altered fields is introducing a new PK,
@@ -185,9 +250,9 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
             body[create_field.name] = create_field
             # Choose a default and insert it into the copy map
             if not create_field.many_to_many and create_field.concrete:
-                mapping[create_field.column] = self.quote_value(
+                mapping[create_field.column] = [self.quote_value(
                     self.effective_default(create_field)
-                )
+                )]
         # Add in any altered fields
         if alter_field:
             old_field, new_field = alter_field
@@ -195,13 +260,13 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
             mapping.pop(old_field.column, None)
             body[new_field.name] = new_field
             if old_field.null and not new_field.null:
-                case_sql = "coalesce(%(col)s, %(default)s)" % {
-                    'col': self.quote_name(old_field.column),
-                    'default': self.quote_value(self.effective_default(new_field))
-                }
-                mapping[new_field.column] = case_sql
+                mapping[new_field.column] = [
+                    'coalesce(',
+                    (old_field.column,),
+                    ', %s)' % self.quote_value(self.effective_default(new_field)),
+                ]
             else:
-                mapping[new_field.column] = self.quote_name(old_field.column)
+                mapping[new_field.column] = [(old_field.column,)]
             rename_mapping[old_field.name] = new_field.name
         # Remove any deleted fields
         if delete_field:
@@ -210,6 +275,15 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
             # Remove any implicit M2M tables
             if delete_field.many_to_many and delete_field.remote_field.through._meta.auto_created:
                 return self.delete_model(delete_field.remote_field.through)
+        if copy_mapping is not None:
+            mapping = copy_mapping
+        elif deferring:
+            if self._deferred_remake is not None:
+                mapping = self._merge_mappings(mapping, self._deferred_remake[4])
+            self._deferred_remake = (model, create_field, delete_field, alter_field, mapping)
+            if restore_pk_field:
+                restore_pk_field.primary_key = True
+            return
         # Work inside a new app registry
         apps = Apps()
 
@@ -283,7 +357,10 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
         self.execute("INSERT INTO %s (%s) SELECT %s FROM %s" % (
             self.quote_name(new_model._meta.db_table),
             ', '.join(self.quote_name(x) for x in mapping),
-            ', '.join(mapping.values()),
+            ', '.join(
+                ''.join(part if isinstance(part, str) else self.quote_name(part[0]) for part in parts)
+                for parts in mapping.values()
+            ),
             self.quote_name(model._meta.db_table),
         ))
 
@@ -304,6 +381,25 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
         if restore_pk_field:
             restore_pk_field.primary_key = True
 
+    @staticmethod
+    def _merge_mappings(mapping, previous_mapping):
+        """
+        Return mapping with its references to the columns of the existing
+        table replaced by their expression in previous_mapping.
+        """
+        merged = {}
+        for column, parts in mapping.items():
+            merged_parts = []
+            for part in parts:
+                if isinstance(part, str):
+                    merged_parts.append(part)
+                elif len(previous_mapping[part[0]]) == 1:
+                    merged_parts.extend(previous_mapping[part[0]])
+                else:
+                    merged_parts.extend(['(', *previous_mapping[part[0]], ')'])
+            merged[column] = merged_parts
+        return merged
+
     def delete_model(self, model, handle_autom2m=True):
         if handle_autom2m:
             super().delete_model(model)
@@ -325,7 +421,17 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
         # Special-case implicit M2M tables
         if field.many_to_many and field.remote_field.through._meta.auto_created:
             return self.create_model(field.remote_field.through)
-        self._remake_table(model, create_field=field)
+        if (
+            # Fold it into a pending rebuild of the table.
+            self._has_deferred_remake(model) or
+            # Primary keys and unique columns aren't supported by ALTER
+            # TABLE ADD COLUMN, and defaults couldn't be dropped afterwards.
+            field.primary_key or field.unique or not field.null or
+            self.effective_default(field) is not None
+        ):
+            self._remake_table(model, create_field=field)
+        else:
+            super().add_field(model, field)
 
     def remove_field(self, model, field):
         """
@@ -343,7 +449,39 @@ class DatabaseSchemaEditor(BaseDatabaseSchemaEditor):
             # It might not actually have a column behind it
             if field.db_parameters(connection=self.connection)['type'] is None:
                 return
-            self._remake_table(model, delete_field=field)
+            if self._can_drop_column(model, field):
+                super().remove_field(model, field)
+            else:
+                self._remake_table(model, delete_field=field)
+
+    def _can_drop_column(self, model, field):
+        """
+        Return whether ALTER TABLE DROP COLUMN can remove the column of field,
+        which fails if the column is part of a key, an index or a table
+        constraint.
+        """
+        if (
+            not self.connection.features.can_alter_table_drop_column or
+            self._has_deferred_remake(model) or
+            field.primary_key or field.unique or field.db_index or
+            (field.remote_field and field.db_constraint)
+        ):
+            return False
+        opts = model._meta
+        if any(field.name in fields for fields in chain(opts.unique_together, opts.index_together)):
+            return False
+        # Conditions of partial indexes and check constraints may refer to
+        # any column.
+        if any(
+            index.condition is not None or field.name in index.fields or ('-' + field.name) in index.fields
+            for index in opts.indexes
+        ):
+            return False
+        return all(
+            isinstance(constraint, UniqueConstraint) and not constraint.condition and
+            field.name not in constraint.fields
+            for constraint in opts.constraints
+        )
 
     def _alter_field(self, model, old_field, new_field, old_type, new_type,
                      old_db_params, new_db_params, strict=False):
@@ -47,6 +47,10 @@ class CursorWrapper:
     # code must run when the method is invoked, not just when it is accessed.
 
     def callproc(self, procname, params=None, kparams=None):
+        if self.db.pending_savepoints:
+            self.db.create_pending_savepoints()
+        if self.db.write_batch:
+            self.db.write_batch.flush()
         # Keyword parameters for callproc aren't supported in PEP 249, but the
         # database driver may support them (e.g. cx_Oracle).
         if kparams is not None and not self.db.features.supports_callproc_kwargs:
@@ -70,7 +74,21 @@ class CursorWrapper:
     def executemany(self, sql, param_list):
         return self._execute_with_wrappers(sql, param_list, many=True, executor=self._executemany)
 
+    def _prepare_statement(self, sql):
+        """
+        Bring the connection up to date before sql runs. Backends with
+        methods running statements outside of execute() must call it too.
+        """
+        # Savepoints of the enclosing atomic blocks must exist before any
+        # statement that may have to be rolled back to them runs.
+        if self.db.pending_savepoints and self.db.needs_savepoint(sql):
+            self.db.create_pending_savepoints()
+        # Deferred writes must reach the database before anything else runs.
+        if self.db.write_batch:
+            self.db.write_batch.flush()
+
     def _execute_with_wrappers(self, sql, params, many, executor):
+        self._prepare_statement(sql)
         context = {'connection': self.db, 'cursor': self}
         for wrapper in reversed(self.db.execute_wrappers):
             executor = functools.partial(wrapper, executor)
@@ -91,6 +109,46 @@ class CursorWrapper:
             return self.cursor.executemany(sql, param_list)
 
 
+class WriteBatch:
+    """
+    Write statements whose execution is deferred so that they reach the
+    database together, through ops.execute_batch(), right before the next
+    statement or the commit. Each statement may have a callback receiving
+    the number of rows it affected.
+    """
+    def __init__(self, db):
+        self.db = db
+        self.statements = []
+
+    def __bool__(self):
+        return bool(self.statements)
+
+    def __len__(self):
+        return len(self.statements)
+
+    def add(self, sql, params, callback=None):
+        # The statements already in the batch were added before the pending
+        # savepoints, and are flushed before they're created.
+        if self.db.pending_savepoints:
+            self.db.create_pending_savepoints()
+        self.statements.append((sql, params, callback))
+
+    def clear(self):
+        self.statements = []
+
+    def flush(self):
+        statements, self.statements = self.statements, []
+        if not statements or self.db.needs_rollback:
+            return
+        with self.db.cursor() as cursor:
+            rowcounts = self.db.ops.execute_batch(
+                cursor, [(sql, params) for sql, params, callback in statements],
+            )
+        for (sql, params, callback), rowcount in zip(statements, rowcounts):
+            if callback is not None:
+                callback(rowcount)
+
+
 class CursorDebugWrapper(CursorWrapper):
 
     # XXX callproc isn't instrumented at this time.
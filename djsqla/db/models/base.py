@@ -1,7 +1,7 @@
 import copy
 import inspect
 import warnings
-from functools import partialmethod
+from functools import partial, partialmethod
 from itertools import chain
 
 from django.apps import apps
@@ -21,10 +21,15 @@ from django.db.models import (
 from django.db.models.constants import LOOKUP_SEP
 from django.db.models.constraints import CheckConstraint, UniqueConstraint
 from django.db.models.deletion import CASCADE, Collector
+from django.db.models.fields.files import FileDescriptor
 from django.db.models.fields.related import (
     ForeignObjectRel, OneToOneField, lazy_related_operation, resolve_relation,
 )
+from django.db.models.fields.related_descriptors import (
+    ForeignKeyDeferredAttribute,
+)
 from django.db.models.functions import Coalesce
+from django.db.models.identity_map import get_identity_map
 from django.db.models.manager import Manager
 from django.db.models.options import Options
 from django.db.models.query import Q
@@ -49,6 +54,16 @@ class Deferred:
 
 DEFERRED = Deferred()
 
+# Attribute descriptors whose __set__() has no effect on a freshly created
+# instance beyond storing the value in __dict__.
+_DIRECT_HYDRATION_DESCRIPTORS = (FileDescriptor, ForeignKeyDeferredAttribute)
+
+try:
+    from sqlalchemy.cresultproxy import populate_dict
+except ImportError:
+    def populate_dict(obj_dict, keys, row, start):
+        obj_dict.update(zip(keys, row[start:start + len(keys)]))
+
 
 def subclass_exception(name, bases, module, attached_to):
     """
@@ -515,6 +530,55 @@ class Model(metaclass=ModelBase):
         new._state.db = db
         return new
 
+    @classmethod
+    def _can_hydrate_directly(cls, field_names):
+        """
+        Return True if instances loaded with the given attnames may be built
+        by writing the row straight into __dict__, which is only equivalent
+        to from_db() when no pre_init/post_init receivers, no custom
+        __init__()/from_db() and no side-effecting attribute setters exist.
+        """
+        if cls.from_db.__func__ is not Model.from_db.__func__:
+            return False
+        for klass in cls.__mro__[:-1]:
+            if klass is not Model and (
+                    '__init__' in klass.__dict__ or '__new__' in klass.__dict__):
+                return False
+        if pre_init.has_listeners(cls) or post_init.has_listeners(cls):
+            return False
+        for attname in field_names:
+            descriptor = inspect.getattr_static(cls, attname, None)
+            if (hasattr(type(descriptor), '__set__') and
+                    type(descriptor) not in _DIRECT_HYDRATION_DESCRIPTORS):
+                return False
+        return True
+
+    @classmethod
+    def _get_from_db_hydrator(cls, db, field_names, start, end):
+        """
+        Return a callable that builds an instance from the row range
+        [start:end] holding the values of field_names. The decision between
+        the direct path and from_db() is taken once, so the caller should
+        build a hydrator per query rather than per row.
+        """
+        if not cls._can_hydrate_directly(field_names):
+            def hydrate(row):
+                return cls.from_db(db, field_names, row[start:end])
+            return hydrate
+
+        field_names = tuple(field_names)
+        new = object.__new__
+
+        def hydrate(row):
+            obj = new(cls)
+            obj_dict = obj.__dict__
+            populate_dict(obj_dict, field_names, row, start)
+            state = obj_dict['_state'] = ModelState()
+            state.adding = False
+            state.db = db
+            return obj
+        return hydrate
+
     def __repr__(self):
         return '<%s: %s>' % (self.__class__.__name__, self)
 
@@ -786,6 +850,10 @@ class Model(metaclass=ModelBase):
             )
         # Store the database on which the object was saved
         self._state.db = using
+        # Other copies of the object are now stale.
+        identity_map = get_identity_map()
+        if identity_map is not None:
+            identity_map.discard(self, using)
         # Once saved, this is no longer a to-be-added instance.
         self._state.adding = False
 
@@ -914,8 +982,42 @@ class Model(metaclass=ModelBase):
                 # database is again checked for if the UPDATE query returns 0.
                 (filtered._update(values) > 0 or filtered.exists())
             )
+        if self._can_defer_update(using):
+            filtered._defer_update(values, partial(
+                self._check_deferred_update, base_qs.model, using, update_fields, forced_update,
+            ))
+            return True
         return filtered._update(values) > 0
 
+    def _can_defer_update(self, using):
+        """
+        Return whether the UPDATE of a save() may be batched with the next
+        writes: the save runs in a transaction.batch_saves() block within an
+        atomic block, and the instance was loaded from the database, so the
+        row almost always exists.
+        """
+        connection = connections[using]
+        return (
+            connection.batching_saves and
+            connection.in_atomic_block and
+            not self._state.adding
+        )
+
+    def _check_deferred_update(self, cls, using, update_fields, forced_update, rowcount):
+        if rowcount:
+            return
+        if update_fields:
+            raise DatabaseError("Save with update_fields did not affect any rows.")
+        if forced_update:
+            raise DatabaseError("Forced update did not affect any rows.")
+        # save() would have inserted the row, but from the state of the
+        # instance at that time, which is gone, and post_save was sent with
+        # created=False.
+        raise DatabaseError(
+            "Batched save() of %s instance with pk %r did not affect any rows."
+            % (cls._meta.object_name, self.pk)
+        )
+
     def _do_insert(self, manager, using, fields, returning_fields, raw):
         """
         Do an INSERT. If returning_fields is defined then this method should
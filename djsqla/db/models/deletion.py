@@ -6,6 +6,7 @@ from operator import attrgetter
 
 from django.db import IntegrityError, connections, transaction
 from django.db.models import query_utils, signals, sql
+from django.db.models.identity_map import get_identity_map
 
 
 class ProtectedError(IntegrityError):
@@ -67,6 +68,12 @@ def DO_NOTHING(collector, field, sub_objs, using):
     pass
 
 
+# Maximum number of relation paths from the deleted queryset to a model for
+# Collector.collect_set_based(). Each path nests one subquery in the
+# statement of the model.
+SET_BASED_MAX_PATHS = 16
+
+
 def get_candidate_relations_to_delete(opts):
     # The candidate relations are the ones that come from N-1 and 1-1 relations.
     # N-N  (i.e., many-to-many) relations aren't candidates for deletion.
@@ -88,6 +95,10 @@ class Collector:
         # fast_deletes is a list of queryset-likes that can be deleted without
         # fetching the objects into memory.
         self.fast_deletes = []
+        # set_based_operations is a list of (queryset, field, value) planned
+        # by collect_set_based(), in execution order. A None field deletes
+        # the queryset's rows, otherwise they are updated to field=value.
+        self.set_based_operations = []
 
         # Tracks deletion-order dependency for databases without transactions
         # or ability to defer constraint checks. Only concrete model classes
@@ -325,6 +336,132 @@ class Collector:
                             objs,
                         )
 
+    def collect_set_based(self, objs):
+        """
+        Plan the deletion of the queryset 'objs' and of everything it
+        cascades to as DELETE and UPDATE statements filtered by nested
+        subqueries, so that no object has to be fetched. There's one
+        statement per model, or per relation for updates, the rows reached
+        through several relations being selected with one OR'ed filter.
+        Only the primary keys of 'objs' are fetched first, in batches for
+        large querysets: the statements change rows its filter may read.
+        Related rows are handled before the rows they refer to, so that the
+        subqueries selecting them from their parents still match.
+
+        Return False, without planning anything, if instances must be
+        collected instead: a model in the cascade has signal receivers, a
+        parent model or a generic relation, a relation uses RESTRICT or a
+        custom on_delete handler, the cascade contains a cycle, or a model
+        is reached through more than SET_BASED_MAX_PATHS relation paths,
+        which would nest as many subqueries in its statement.
+        """
+        if not hasattr(objs, '_raw_delete'):
+            return False
+        operations = self._plan_set_based(objs)
+        if operations is None:
+            return False
+        self.set_based_operations.extend(operations)
+        return True
+
+    def _plan_set_based(self, qs):
+        root = qs.model._meta.concrete_model
+        # {model: [(parent model, cascading field)]}
+        cascades = defaultdict(list)
+        # [(parent model, related model, field, value)]
+        updates = []
+        # [(parent model, related model, field)]
+        protected = []
+        # Models in depth-first post-order, related models first.
+        order = []
+        visiting = set()
+
+        def visit(model):
+            opts = model._meta
+            if (
+                opts.concrete_model._meta.parents or
+                (not opts.auto_created and self._has_signal_listeners(model)) or
+                any(hasattr(field, 'bulk_related_objects') for field in opts.private_fields)
+            ):
+                return False
+            concrete_model = opts.concrete_model
+            visiting.add(concrete_model)
+            for related in get_candidate_relations_to_delete(opts):
+                field = related.field
+                on_delete = field.remote_field.on_delete
+                related_model = related.related_model
+                if on_delete is DO_NOTHING:
+                    continue
+                if on_delete is CASCADE:
+                    child = related_model._meta.concrete_model
+                    if child in visiting or (
+                            not related_model._meta.auto_created and
+                            self._has_signal_listeners(related_model)):
+                        return False
+                    cascades[child].append((concrete_model, field))
+                    if len(cascades[child]) == 1 and not visit(related_model):
+                        return False
+                elif on_delete is PROTECT:
+                    protected.append((concrete_model, related_model, field))
+                elif on_delete is SET_NULL:
+                    updates.append((concrete_model, related_model, field, None))
+                elif on_delete is SET_DEFAULT:
+                    updates.append((concrete_model, related_model, field, field.get_default()))
+                else:
+                    deconstruct = getattr(on_delete, 'deconstruct', None)
+                    if deconstruct is None:
+                        return False
+                    path_name, args, kwargs = deconstruct()
+                    if path_name != 'django.db.models.SET':
+                        return False
+                    value = args[0]
+                    updates.append((concrete_model, related_model, field, value() if callable(value) else value))
+            visiting.discard(concrete_model)
+            order.append(concrete_model)
+            return True
+
+        if not visit(qs.model):
+            return None
+
+        paths = {root: 1}
+        for model in reversed(order):
+            if model is not root:
+                paths[model] = sum(paths[parent] for parent, field in cascades[model])
+                if paths[model] > SET_BASED_MAX_PATHS:
+                    return None
+
+        # The filter of qs may read rows the statements below change, e.g.
+        # through a reverse relation, and would match other rows once they
+        # ran. Select the primary keys up front.
+        pks = list(qs.values_list('pk', flat=True))
+        operations = []
+        updates_operations = []
+        for batch in self.get_del_batches(pks, [root._meta.pk]) if pks else ():
+            # Build the querysets from the root down.
+            querysets = {root: root._base_manager.using(self.using).filter(pk__in=batch)}
+            for model in reversed(order):
+                if model is root:
+                    continue
+                predicate = reduce(operator.or_, (
+                    query_utils.Q(**{'%s__in' % field.name: querysets[parent]})
+                    for parent, field in cascades[model]
+                ))
+                querysets[model] = model._base_manager.using(self.using).filter(predicate)
+
+            for parent, related_model, field in protected:
+                sub_objs = self.related_objects(related_model, [field], querysets[parent])
+                if sub_objs.exists():
+                    PROTECT(self, field, sub_objs, self.using)
+
+            # Updates only change SET_NULL, SET_DEFAULT and SET fields, which
+            # the delete subqueries don't filter on, so they can all run
+            # first.
+            updates_operations.extend(
+                (self.related_objects(related_model, [field], querysets[parent]), field, value)
+                for parent, related_model, field, value in updates
+            )
+            operations.extend((querysets[model], None, None) for model in order)
+        return updates_operations + operations
+
     def related_objects(self, related_model, related_fields, objs):
         """
         Get a QuerySet of the related model to objs via related fields.
@@ -370,16 +507,28 @@ class Collector:
         # number of objects deleted for each model label
         deleted_counter = Counter()
 
+        identity_map = get_identity_map()
+
         # Optimize for the case with a single obj and no dependencies
         if len(self.data) == 1 and len(instances) == 1:
             instance = list(instances)[0]
             if self.can_fast_delete(instance):
                 with transaction.mark_for_rollback_on_error():
                     count = sql.DeleteQuery(model).delete_batch([instance.pk], self.using)
+                if identity_map is not None:
+                    identity_map.discard(instance, self.using)
                 setattr(instance, model._meta.pk.attname, None)
                 return count, {model._meta.label: count}
 
         with transaction.atomic(using=self.using, savepoint=False):
+            # set-based deletes and updates
+            for qs, field, value in self.set_based_operations:
+                if field is None:
+                    count = qs._raw_delete(using=self.using)
+                    deleted_counter[qs.model._meta.label] += count
+                else:
+                    qs.update(**{field.name: value})
+
             # send pre_delete signals
             for model, obj in self.instances_with_model():
                 if not model._meta.auto_created:
@@ -421,7 +570,11 @@ class Collector:
             for (field, value), instances in instances_for_fieldvalues.items():
                 for obj in instances:
                     setattr(obj, field.attname, value)
+                    if identity_map is not None:
+                        identity_map.discard(obj, self.using)
         for model, instances in self.data.items():
             for instance in instances:
+                if identity_map is not None:
+                    identity_map.discard(instance, self.using)
                 setattr(instance, model._meta.pk.attname, None)
         return sum(deleted_counter.values()), dict(deleted_counter)
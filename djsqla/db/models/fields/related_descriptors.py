@@ -66,6 +66,7 @@ and two directions (forward and reverse) for a total of six combinations.
 from django.core.exceptions import FieldError
 from django.db import connections, router, transaction
 from django.db.models import Q, signals
+from django.db.models.identity_map import get_identity_map
 from django.db.models.query import QuerySet
 from django.db.models.query_utils import DeferredAttribute
 from django.utils.functional import cached_property
@@ -138,6 +139,7 @@ class ForwardManyToOneDescriptor:
         else:
             query = {'%s__in' % self.field.related_query_name(): instances}
         queryset = queryset.filter(**query)
+        queryset.query.bind_in_lists = True
 
         # Since we're going to assign directly in the cache,
         # we must manage the reverse relation cache manually.
@@ -149,6 +151,15 @@ class ForwardManyToOneDescriptor:
 
     def get_object(self, instance):
         qs = self.get_queryset(instance=instance)
+        identity_map = get_identity_map()
+        if identity_map is not None and not qs.query.where:
+            rel_fields = self.field.foreign_related_fields
+            if len(rel_fields) == 1 and rel_fields[0].primary_key:
+                rel_obj = identity_map.get(
+                    self.field.remote_field.model, getattr(instance, self.field.attname), qs.db,
+                )
+                if rel_obj is not None:
+                    return rel_obj
         # Assuming the database enforces foreign keys, this won't fail.
         return qs.get(self.field.get_reverse_related_filter(instance))
 
@@ -371,6 +382,7 @@ class ReverseOneToOneDescriptor:
         instances_dict = {instance_attr(inst): inst for inst in instances}
         query = {'%s__in' % self.related.field.name: instances}
         queryset = queryset.filter(**query)
+        queryset.query.bind_in_lists = True
 
         # Since we're going to assign directly in the cache,
         # we must manage the reverse relation cache manually.
@@ -629,6 +641,7 @@ def create_reverse_many_to_one_manager(superclass, rel):
             instances_dict = {instance_attr(inst): inst for inst in instances}
             query = {'%s__in' % self.field.name: instances}
             queryset = queryset.filter(**query)
+            queryset.query.bind_in_lists = True
 
             # Since we just bypassed this class' get_queryset(), we must manage
             # the reverse relation manually.
@@ -908,6 +921,7 @@ def create_forward_many_to_many_manager(superclass, rel, reverse):
 
             query = {'%s__in' % self.query_field_name: instances}
             queryset = queryset._next_is_sticky().filter(**query)
+            queryset.query.bind_in_lists = True
 
             # M2M: need to annotate the query in order to get the primary model
             # that the secondary model was actually related to. We know that
@@ -0,0 +1,119 @@
+"""
+Identity map of the model instances loaded in a unit of work, such as a
+request.
+
+Within use_identity_map(), or IdentityMapMiddleware, instances loaded by
+querysets are remembered by (model, primary key, database alias). A get()
+on the primary key of an unfiltered queryset and the access to a forward
+foreign key return the remembered instance instead of querying the
+database again. Instances are held through weak references, so the map
+never keeps alive objects the code no longer uses.
+
+Saving or deleting an instance forgets it, as do update(), bulk_update()
+and the raw deletes of cascades for every instance of their model.
+Changes made through raw SQL or by other connections aren't seen.
+
+The remembered instance is returned as it is in memory, unsaved changes
+included. Code fetching the row again to compare it with a modified
+instance, or to discard its changes, must not use get(pk=...) within the
+map, e.g.:
+
+    obj.name = 'new'
+    original = Model.objects.get(pk=obj.pk)  # obj itself, name is 'new'.
+
+Use obj.refresh_from_db(), whose filtered query bypasses the map, or run
+that code outside of use_identity_map().
+"""
+import weakref
+from contextlib import ContextDecorator
+
+from asgiref.local import Local
+
+_local = Local()
+
+
+class IdentityMap:
+    def __init__(self):
+        self._objects = weakref.WeakValueDictionary()
+        # Number of queries avoided by returning a remembered instance.
+        self.queries_saved = 0
+
+    def __len__(self):
+        return len(self._objects)
+
+    def get(self, model, pk, using):
+        """
+        Return the instance of model with the given primary key loaded from
+        the database alias using, or None if it isn't in the map.
+        """
+        try:
+            obj = self._objects.get((model._meta.concrete_model, pk, using))
+        except TypeError:
+            # Unhashable primary key value.
+            return None
+        if obj is None or type(obj) is not model:
+            return None
+        self.queries_saved += 1
+        return obj
+
+    def add(self, obj, using):
+        self._objects[obj._meta.concrete_model, obj.pk, using] = obj
+
+    def discard(self, obj, using):
+        """Forget obj and the instances of its parent models."""
+        opts = obj._meta
+        pk = obj.pk
+        for model in [opts.concrete_model, *opts.get_parent_list()]:
+            self._objects.pop((model, pk, using), None)
+
+    def discard_model(self, model, using):
+        """Forget every instance of model and of its parent models."""
+        opts = model._meta
+        models = {opts.concrete_model, *opts.get_parent_list()}
+        for key in list(self._objects.keys()):
+            if key[0] in models and key[2] == using:
+                self._objects.pop(key, None)
+
+    def clear(self):
+        self._objects.clear()
+
+
+def get_identity_map():
+    """Return the identity map of the current unit of work, if any."""
+    stack = getattr(_local, 'stack', None)
+    return stack[-1] if stack else None
+
+
+class IdentityMapScope(ContextDecorator):
+    """
+    Context manager and decorator making an identity map available to the
+    code it wraps. Nested scopes share the map of the outermost one.
+    """
+    def __enter__(self):
+        stack = getattr(_local, 'stack', None)
+        if stack is None:
+            stack = _local.stack = []
+        identity_map = stack[-1] if stack else IdentityMap()
+        stack.append(identity_map)
+        return identity_map
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        _local.stack.pop()
+
+
+def use_identity_map(func=None):
+    # Bare decorator: @use_identity_map
+    if callable(func):
+        return IdentityMapScope()(func)
+    # Decorator: @use_identity_map() and context manager: with use_identity_map():
+    return IdentityMapScope()
+
+
+class IdentityMapMiddleware:
+    """Use an identity map for the duration of each request."""
+    def __init__(self, get_response):
+        self.get_response = get_response
+
+    def __call__(self, request):
+        with IdentityMapScope():
+            return self.get_response(request)
@@ -0,0 +1,246 @@
+"""
+Keyset pagination, used by QuerySet.seek() and QuerySet.keyset_iterator().
+
+Rather than skipping rows with OFFSET, a page is selected with a condition
+on the ordering columns of the last row of the previous page, e.g.
+(created, id) > (%s, %s). With an index on these columns, any page costs as
+much as the first one.
+
+The ordering must be total, so it's completed with the primary key unless
+one of its fields is unique, and its columns can't be NULL.
+"""
+import base64
+import binascii
+import datetime
+import json
+
+from django.db.models import fields
+from django.db.models.constants import LOOKUP_SEP
+from django.db.models.expressions import Expression, F, OrderBy, Value
+from django.db.models.sql.datastructures import MultiJoin
+from django.db.utils import NotSupportedError
+
+
+class KeysetCondition(Expression):
+    """
+    Condition selecting the rows that come after the given values of
+    expressions, in ascending or descending order of each expression.
+    """
+    conditional = True
+    output_field = fields.BooleanField()
+
+    def __init__(self, expressions, values, descending):
+        super().__init__()
+        self.expressions = list(expressions)
+        self.values = list(values)
+        self.descending = list(descending)
+
+    def __repr__(self):
+        return '{}({}, {}, descending={})'.format(
+            self.__class__.__name__, self.expressions, self.values, self.descending,
+        )
+
+    def get_source_expressions(self):
+        return self.expressions + self.values
+
+    def set_source_expressions(self, exprs):
+        self.expressions = exprs[:len(self.descending)]
+        self.values = exprs[len(self.descending):]
+
+    def as_sql(self, compiler, connection):
+        columns = [compiler.compile(expression) for expression in self.expressions]
+        values = [compiler.compile(value) for value in self.values]
+        if len(columns) == 1:
+            return self._compare(columns[0], values[0], self.descending[0])
+        if connection.features.supports_row_value_comparison and len(set(self.descending)) == 1:
+            sql = '(%s) %s (%s)' % (
+                ', '.join(sql for sql, params in columns),
+                '<' if self.descending[0] else '>',
+                ', '.join(sql for sql, params in values),
+            )
+            params = []
+            for _, column_params in columns:
+                params.extend(column_params)
+            for _, value_params in values:
+                params.extend(value_params)
+            return sql, params
+        # (a > x) OR (a = x AND b > y) OR (a = x AND b = y AND c > z), with
+        # a >= x in front so that an index on a still bounds the scan.
+        leading_sql, leading_params = self._compare(columns[0], values[0], self.descending[0], '=')
+        alternatives = []
+        params = list(leading_params)
+        for index, descending in enumerate(self.descending):
+            conditions = []
+            for column, value in zip(columns[:index], values[:index]):
+                sql, condition_params = self._equal(column, value)
+                conditions.append(sql)
+                params.extend(condition_params)
+            sql, condition_params = self._compare(columns[index], values[index], descending)
+            conditions.append(sql)
+            params.extend(condition_params)
+            alternatives.append('(%s)' % ' AND '.join(conditions))
+        return '%s AND (%s)' % (leading_sql, ' OR '.join(alternatives)), params
+
+    @staticmethod
+    def _compare(column, value, descending, or_equal=''):
+        return '%s %s%s %s' % (column[0], '<' if descending else '>', or_equal, value[0]), [*column[1], *value[1]]
+
+    @staticmethod
+    def _equal(column, value):
+        return '%s = %s' % (column[0], value[0]), [*column[1], *value[1]]
+
+
+class Keyset:
+    """
+    The ordering of a queryset as a list of (path, descending, field)
+    terms, where field is the model field holding the values of path, and
+    the list of the names under which instances and dicts of values() hold
+    these values: paths ending with a foreign key or pk end with the
+    attname of the field instead.
+    """
+    def __init__(self, terms, keys):
+        self.terms = terms
+        self.keys = keys
+
+    @classmethod
+    def from_queryset(cls, queryset):
+        query = queryset.query
+        if query.combinator:
+            raise NotSupportedError('Keyset pagination is not supported on combined queries.')
+        if query.distinct_fields or query.extra_order_by:
+            raise ValueError("Keyset pagination can't be used with distinct(*fields) or extra(order_by=...).")
+        opts = queryset.model._meta
+        ordering = query.order_by or (opts.ordering if query.default_ordering else ())
+        terms = []
+        keys = []
+        for item in ordering:
+            if isinstance(item, OrderBy) and isinstance(item.expression, F):
+                path, descending = item.expression.name, item.descending
+            elif isinstance(item, F):
+                path, descending = item.name, False
+            elif isinstance(item, str) and item != '?':
+                path, descending = item.lstrip('-'), item.startswith('-')
+            else:
+                raise ValueError(
+                    'Keyset pagination only supports ordering by fields, not by %r.' % (item,)
+                )
+            if not query.standard_ordering:
+                descending = not descending
+            field, key, unique = cls._resolve_path(query, opts, path)
+            terms.append((path, descending, field))
+            keys.append(key)
+            if unique:
+                break
+        else:
+            # Make the ordering total.
+            field, key, unique = cls._resolve_path(query, opts, 'pk')
+            terms.append(('pk', terms[-1][1] if terms else False, field))
+            keys.append(key)
+        return cls(terms, keys)
+
+    @staticmethod
+    def _resolve_path(query, opts, path):
+        """
+        Return the field holding the values of the ordering path, the name
+        of these values in instances and dicts of values(), and whether the
+        field is unique in the table of the queryset.
+        """
+        names = path.split(LOOKUP_SEP)
+        if names[0] in query.annotations:
+            raise ValueError("Keyset pagination doesn't support ordering by annotations (%r)." % path)
+        try:
+            path_infos, final_field, targets, rest = query.names_to_path(
+                names, opts, allow_many=False, fail_on_missing=True,
+            )
+        except MultiJoin:
+            raise ValueError("Keyset pagination doesn't support ordering by multi-valued relations (%r)." % path)
+        if rest:
+            raise ValueError("Keyset pagination doesn't support ordering by transforms (%r)." % path)
+        if (final_field.is_relation and names[-1] not in (final_field.attname, 'pk') and
+                final_field.related_model._meta.ordering):
+            raise ValueError(
+                "Ordering by %r uses the ordering of the related model, order by "
+                "its fields instead for keyset pagination." % path
+            )
+        if final_field.null or any(not path_info.direct or path_info.join_field.null for path_info in path_infos):
+            raise ValueError("Keyset pagination doesn't support ordering by nullable columns (%r)." % path)
+        key = LOOKUP_SEP.join([*names[:-1], final_field.attname])
+        return targets[0], key, len(names) == 1 and final_field.unique
+
+    @property
+    def ordering(self):
+        return [('-%s' if descending else '%s') % path for path, descending, field in self.terms]
+
+    def get_condition(self, values):
+        return KeysetCondition(
+            [F(path) for path, descending, field in self.terms],
+            [Value(value, output_field=field) for value, (path, descending, field) in zip(values, self.terms)],
+            [descending for path, descending, field in self.terms],
+        )
+
+    def check_values_fields(self, names):
+        """
+        Raise ValueError unless the dicts of values() returning the given
+        field names hold the values of every ordering path.
+        """
+        names = set(names)
+        missing = [
+            path for (path, descending, field), key in zip(self.terms, self.keys)
+            if key not in names and path not in names
+        ]
+        if missing:
+            raise ValueError(
+                'Keyset pagination over values() requires the ordering fields '
+                '%s.' % ', '.join(map(repr, missing))
+            )
+
+    def get_values(self, position):
+        """
+        Return the values of the ordering paths at position, a list or tuple
+        of values, a dict of values() or a model instance.
+        """
+        if isinstance(position, (list, tuple)):
+            values = list(position)
+            if len(values) != len(self.terms):
+                raise ValueError(
+                    'Expected %d values for the ordering %s.' % (len(self.terms), ', '.join(self.ordering))
+                )
+        elif isinstance(position, dict):
+            self.check_values_fields(position)
+            values = [
+                position[key] if key in position else position[path]
+                for (path, descending, field), key in zip(self.terms, self.keys)
+            ]
+        else:
+            values = []
+            for key in self.keys:
+                value = position
+                for name in key.split(LOOKUP_SEP):
+                    value = getattr(value, name)
+                values.append(value)
+        if any(value is None for value in values):
+            raise ValueError('Keyset positions cannot contain None.')
+        return values
+
+    def encode(self, values):
+        """Return an opaque token for the position at values."""
+        from django.core.serializers.json import DjangoJSONEncoder
+        # DjangoJSONEncoder truncates them to milliseconds, while positions
+        # must round-trip exactly.
+        values = [
+            value.isoformat() if isinstance(value, (datetime.datetime, datetime.time)) else value
+            for value in values
+        ]
+        data = json.dumps([self.ordering, values], cls=DjangoJSONEncoder, separators=(',', ':'))
+        return base64.urlsafe_b64encode(data.encode()).decode().rstrip('=')
+
+    def decode(self, token):
+        """Return the values of the position encoded by encode()."""
+        try:
+            data = base64.urlsafe_b64decode(token + '=' * (-len(token) % 4))
+            ordering, values = json.loads(data.decode())
+        except (binascii.Error, UnicodeDecodeError, TypeError, ValueError):
+            raise ValueError('Invalid keyset token.')
+        if ordering != self.ordering or len(values) != len(self.terms):
+            raise ValueError("The keyset token doesn't match the ordering of the queryset.")
+        return [field.to_python(value) for value, (path, descending, field) in zip(values, self.terms)]
@@ -378,11 +378,43 @@ class In(FieldGetDbPrepValueIterableMixin, BuiltinLookup):
         return 'IN %s' % rhs
 
     def as_sql(self, compiler, connection):
+        if self.rhs_is_direct_value() and compiler.query.bind_in_lists:
+            bound = self.bound_list_as_sql(compiler, connection)
+            if bound is not None:
+                return bound
         max_in_list_size = connection.ops.max_in_list_size()
         if self.rhs_is_direct_value() and max_in_list_size and len(self.rhs) > max_in_list_size:
             return self.split_parameter_list_as_sql(compiler, connection)
         return super().as_sql(compiler, connection)
 
+    def bound_list_as_sql(self, compiler, connection):
+        """
+        Return SQL that is the same for any number of values: the values are
+        either bound as a single parameter, when the backend supports it, or
+        padded to a power of two by repeating the last one. Return None if
+        neither is possible.
+        """
+        try:
+            rhs = OrderedSet(self.rhs)
+        except TypeError:  # Unhashable items in self.rhs
+            rhs = self.rhs
+        if not rhs:
+            raise EmptyResultSet
+        sqls, sqls_params = self.batch_process_rhs(compiler, connection, rhs)
+        if len(sqls_params) != len(sqls) or any(sql != '%s' for sql in sqls):
+            return None
+        lhs, lhs_params = self.process_lhs(compiler, connection)
+        bound = connection.ops.bound_in_list_sql(lhs, sqls_params, self.lhs.output_field)
+        if bound is not None:
+            sql, params = bound
+            return sql, (*lhs_params, *params)
+        size = 1 << (len(sqls_params) - 1).bit_length()
+        max_size = connection.ops.max_in_list_size() or connection.features.max_query_params
+        if max_size and size > max_size:
+            return None
+        params = (*sqls_params, *[sqls_params[-1]] * (size - len(sqls_params)))
+        return '%s IN (%s)' % (lhs, ', '.join(['%s'] * size)), (*lhs_params, *params)
+
     def split_parameter_list_as_sql(self, compiler, connection):
         # This is a special case for databases which limit the number of
         # elements which can appear in an 'IN' clause.
@@ -17,6 +17,10 @@ class BaseManager:
     #: thus be available in e.g. RunPython operations.
     use_in_migrations = False
 
+    #: If set to True, count() on the querysets of the manager returns an
+    #: estimate for large tables, see QuerySet.count().
+    approximate_count = False
+
     def __new__(cls, *args, **kwargs):
         # Capture the arguments to make returning them trivial.
         obj = super().__new__(cls)
@@ -141,7 +145,10 @@ class BaseManager:
         Return a new QuerySet object. Subclasses can override this method to
         customize the behavior of the Manager.
         """
-        return self._queryset_class(model=self.model, using=self._db, hints=self._hints)
+        queryset = self._queryset_class(model=self.model, using=self._db, hints=self._hints)
+        if self.approximate_count:
+            queryset.query.approximate_count = True
+        return queryset
 
     def all(self):
         # We can't proxy this method through the `QuerySet` like we do for the
@@ -129,6 +129,9 @@ class Options:
 
         self.default_related_name = None
 
+        # Sharding of the rows of the model, set by ShardedManager.
+        self.sharding = None
+
     @property
     def label(self):
         return '%s.%s' % (self.app_label, self.object_name)
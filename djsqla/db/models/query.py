@@ -6,14 +6,14 @@ import copy
 import operator
 import warnings
 from collections import namedtuple
-from functools import lru_cache
+from functools import lru_cache, partial
 from itertools import chain
 
 from django.conf import settings
 from django.core import exceptions
 from django.db import (
-    DJANGO_VERSION_PICKLE_KEY, IntegrityError, connections, router,
-    transaction,
+    DEFAULT_DB_ALIAS, DJANGO_VERSION_PICKLE_KEY, IntegrityError, connections,
+    router, transaction,
 )
 from django.db.models import DateField, DateTimeField, sql
 from django.db.models.constants import LOOKUP_SEP
@@ -21,6 +21,9 @@ from django.db.models.deletion import Collector
 from django.db.models.expressions import Case, Expression, F, Value, When
 from django.db.models.fields import AutoField
 from django.db.models.functions import Cast, Trunc
+from django.db.models.identity_map import get_identity_map
+from django.db.models.keyset import Keyset
+from django.db.models.query_cache import query_cache
 from django.db.models.query_utils import FilteredRelation, Q
 from django.db.models.sql.constants import CURSOR, GET_ITERATOR_CHUNK_SIZE
 from django.db.utils import NotSupportedError
@@ -59,7 +62,14 @@ class ModelIterable(BaseIterable):
         model_fields_start, model_fields_end = select_fields[0], select_fields[-1] + 1
         init_list = [f[0].target.attname
                      for f in select[model_fields_start:model_fields_end]]
-        related_populators = get_related_populators(klass_info, select, db)
+        hydrate = model_cls._get_from_db_hydrator(db, init_list, model_fields_start, model_fields_end)
+        # Share related instances across rows unless the caller is streaming
+        # with iterator(), which must not hold on to every object fetched.
+        related_plan = RelatedPopulationPlan(klass_info, select, db, share_instances=not self.chunked_fetch)
+        # Remember fully loaded instances in the identity map, if any.
+        identity_map = get_identity_map()
+        if identity_map is not None and len(init_list) != len(model_cls._meta.concrete_fields):
+            identity_map = None
         known_related_objects = [
             (field, related_objs, operator.attrgetter(*[
                 field.attname
@@ -69,9 +79,9 @@ class ModelIterable(BaseIterable):
             ])) for field, related_objs in queryset._known_related_objects.items()
         ]
         for row in compiler.results_iter(results):
-            obj = model_cls.from_db(db, init_list, row[model_fields_start:model_fields_end])
-            for rel_populator in related_populators:
-                rel_populator.populate(row, obj)
+            obj = hydrate(row)
+            if related_plan:
+                related_plan.populate(row, obj)
             if annotation_col_map:
                 for attr_name, col_pos in annotation_col_map.items():
                     setattr(obj, attr_name, row[col_pos])
@@ -89,6 +99,8 @@ class ModelIterable(BaseIterable):
                 else:
                     setattr(obj, field.name, rel_obj)
 
+            if identity_map is not None:
+                identity_map.add(obj, db)
             yield obj
 
 
@@ -108,9 +120,11 @@ class ValuesIterable(BaseIterable):
             *query.values_select,
             *query.annotation_select,
         ]
-        indexes = range(len(names))
-        for row in compiler.results_iter(chunked_fetch=self.chunked_fetch, chunk_size=self.chunk_size):
-            yield {names[i]: row[i] for i in indexes}
+        # Build the dicts with C-level dict(zip()) rather than a per-row
+        # comprehension; rows may be wider than names (ordering columns),
+        # which zip() ignores.
+        rows = compiler.results_iter(chunked_fetch=self.chunked_fetch, chunk_size=self.chunk_size)
+        return map(dict, map(partial(zip, names), rows))
 
 
 class ValuesListIterable(BaseIterable):
@@ -140,7 +154,9 @@ class ValuesListIterable(BaseIterable):
                     rowfactory,
                     compiler.results_iter(chunked_fetch=self.chunked_fetch, chunk_size=self.chunk_size)
                 )
-        return compiler.results_iter(tuple_expected=True, chunked_fetch=self.chunked_fetch, chunk_size=self.chunk_size)
+        # Rows from results_iter() are already tuples in the right order, so
+        # they're handed out as-is.
+        return compiler.results_iter(chunked_fetch=self.chunked_fetch, chunk_size=self.chunk_size)
 
 
 class NamedValuesListIterable(ValuesListIterable):
@@ -164,9 +180,7 @@ class NamedValuesListIterable(ValuesListIterable):
             query = queryset.query
             names = [*query.extra_select, *query.values_select, *query.annotation_select]
         tuple_class = self.create_namedtuple_class(*names)
-        new = tuple.__new__
-        for row in super().__iter__():
-            yield new(tuple_class, row)
+        return map(partial(tuple.__new__, tuple_class), super().__iter__())
 
 
 class FlatValuesListIterable(BaseIterable):
@@ -178,8 +192,10 @@ class FlatValuesListIterable(BaseIterable):
     def __iter__(self):
         queryset = self.queryset
         compiler = queryset.query.get_compiler(queryset.db)
-        for row in compiler.results_iter(chunked_fetch=self.chunked_fetch, chunk_size=self.chunk_size):
-            yield row[0]
+        return map(
+            operator.itemgetter(0),
+            compiler.results_iter(chunked_fetch=self.chunked_fetch, chunk_size=self.chunk_size),
+        )
 
 
 class QuerySet:
@@ -366,6 +382,29 @@ class QuerySet:
         use_chunked_fetch = not connections[self.db].settings_dict.get('DISABLE_SERVER_SIDE_CURSORS')
         return self._iterator(use_chunked_fetch, chunk_size)
 
+    def keyset_iterator(self, chunk_size=2000):
+        """
+        An iterator over the results of the QuerySet fetched in pages of
+        chunk_size rows with seek(), so that every query costs the same
+        however far the iteration goes.
+        """
+        if chunk_size <= 0:
+            raise ValueError('Chunk size must be strictly positive.')
+        if self._iterable_class not in (ModelIterable, ValuesIterable):
+            raise TypeError('keyset_iterator() can only iterate over model instances or values().')
+        keyset = Keyset.from_queryset(self)
+        if self._iterable_class is ValuesIterable:
+            keyset.check_values_fields(
+                self._fields or [field.attname for field in self.model._meta.concrete_fields]
+            )
+        values = None
+        while True:
+            page = list(self._seek(keyset, values, chunk_size))
+            yield from page
+            if len(page) < chunk_size:
+                return
+            values = keyset.get_values(page[-1])
+
     def aggregate(self, *args, **kwargs):
         """
         Return a dictionary containing the calculations (aggregation)
@@ -394,17 +433,25 @@ class QuerySet:
                 raise TypeError("%s is not an aggregate expression" % alias)
         return query.get_aggregation(self.db, kwargs)
 
-    def count(self):
+    def count(self, *, approximate=None):
         """
         Perform a SELECT COUNT() and return the number of records as an
         integer.
 
         If the QuerySet is already fully cached, return the length of the
         cached results set to avoid multiple SELECT COUNT(*) calls.
+
+        If approximate is True, or None and the queryset comes from a manager
+        with approximate_count set, return an estimate of the number of
+        records from the statistics of the database when it's large.
         """
         if self._result_cache is not None:
             return len(self._result_cache)
 
+        if approximate is None:
+            approximate = self.query.approximate_count
+        if approximate:
+            return self.query.get_approximate_count(using=self.db)
         return self.query.get_count(using=self.db)
 
     def get(self, *args, **kwargs):
@@ -412,6 +459,11 @@ class QuerySet:
         Perform the query and return a single object matching the given
         keyword arguments.
         """
+        identity_map = get_identity_map()
+        if identity_map is not None:
+            obj = self._get_from_identity_map(identity_map, args, kwargs)
+            if obj is not None:
+                return obj
         clone = self._chain() if self.query.combinator else self.filter(*args, **kwargs)
         if self.query.can_filter() and not self.query.distinct_fields:
             clone = clone.order_by()
@@ -434,6 +486,31 @@ class QuerySet:
             )
         )
 
+    def _get_from_identity_map(self, identity_map, args, kwargs):
+        """
+        Return the instance get() would return if the lookup is on the
+        primary key of an unfiltered queryset and the instance is in
+        identity_map, None otherwise.
+        """
+        query = self.query
+        if (args or len(kwargs) != 1 or self._iterable_class is not ModelIterable or
+                self._prefetch_related_lookups or query.select_related or
+                query.where or query.combinator or query.select_for_update or
+                query.is_sliced or query.distinct or query.extra or query.annotations or
+                query.deferred_loading != (frozenset(), True)):
+            return None
+        (lookup, value), = kwargs.items()
+        if lookup.endswith(LOOKUP_SEP + 'exact'):
+            lookup = lookup[:-len(LOOKUP_SEP + 'exact')]
+        pk = self.model._meta.pk
+        if lookup not in ('pk', pk.name, pk.attname) or hasattr(value, 'resolve_expression'):
+            return None
+        try:
+            value = pk.to_python(value)
+        except exceptions.ValidationError:
+            return None
+        return identity_map.get(self.model, value, self.db)
+
     def create(self, **kwargs):
         """
         Create a new object with the given kwargs, saving it to the database
@@ -449,13 +526,18 @@ class QuerySet:
             if obj.pk is None:
                 obj.pk = obj._meta.pk.get_pk_value_on_save(obj)
 
-    def bulk_create(self, objs, batch_size=None, ignore_conflicts=False):
+    def bulk_create(self, objs, batch_size=None, ignore_conflicts=False, method='insert'):
         """
         Insert each of the instances into the database. Do *not* call
         save() on each of the instances, do not send any pre/post_save
         signals, and do not set the primary key attribute if it is an
         autoincrement field (except if features.can_return_rows_from_bulk_insert=True).
         Multi-table models are not supported.
+
+        With method='copy', on backends that support it, the rows are
+        streamed with COPY instead of multi-row INSERTs and batch_size is the
+        number of rows encoded at a time. Primary keys are allocated from the
+        table's sequence beforehand and are always set.
         """
         # When you bulk insert you don't get the primary keys back (if it's an
         # autoincrement, except if can_return_rows_from_bulk_insert=True), so
@@ -470,6 +552,15 @@ class QuerySet:
         # Oracle as well, but the semantics for extracting the primary keys is
         # trickier so it's not done yet.
         assert batch_size is None or batch_size > 0
+        if method not in ('insert', 'copy'):
+            raise ValueError("bulk_create() method must be 'insert' or 'copy'.")
+        if method == 'copy':
+            if not connections[self.db].features.supports_bulk_copy:
+                raise NotSupportedError(
+                    "This database backend does not support bulk_create(method='copy')."
+                )
+            if ignore_conflicts:
+                raise ValueError("bulk_create(method='copy') doesn't support ignore_conflicts.")
         # Check that the parents share the same concrete model with the our
         # model to detect the inheritance pattern ConcreteGrandParent ->
         # MultiTableParent -> ProxyChild. Simply checking self.model._meta.proxy
@@ -485,6 +576,10 @@ class QuerySet:
         fields = opts.concrete_fields
         objs = list(objs)
         self._populate_pk_values(objs)
+        if method == 'copy':
+            with transaction.atomic(using=self.db, savepoint=False):
+                self._copy_insert(objs, fields, batch_size)
+            return objs
         with transaction.atomic(using=self.db, savepoint=False):
             objs_with_pk, objs_without_pk = partition(lambda o: o.pk is None, objs)
             if objs_with_pk:
@@ -531,6 +626,18 @@ class QuerySet:
             raise ValueError('bulk_update() cannot be used with primary key fields.')
         if not objs:
             return
+        if self._can_bulk_update_from_values(objs, fields):
+            # One row of values per object: the PK followed by the fields.
+            max_batch_size = connections[self.db].ops.bulk_batch_size(['pk'] + fields, objs)
+            batch_size = min(batch_size, max_batch_size) if batch_size else max_batch_size
+            query = sql.BulkUpdateQuery(self.model, fields=fields)
+            with transaction.atomic(using=self.db, savepoint=False):
+                for i in range(0, len(objs), batch_size):
+                    query.update_batch(objs[i:i + batch_size], self.db)
+            identity_map = get_identity_map()
+            if identity_map is not None:
+                identity_map.discard_model(self.model, self.db)
+            return
         # PK is used twice in the resulting update query, once in the filter
         # and once in the WHEN. Each field will also have one CAST.
         max_batch_size = connections[self.db].ops.bulk_batch_size(['pk', 'pk'] + fields, objs)
@@ -557,6 +664,26 @@ class QuerySet:
                 self.filter(pk__in=pks).update(**update_kwargs)
     bulk_update.alters_data = True
 
+    def _can_bulk_update_from_values(self, objs, fields):
+        """
+        Return True if bulk_update() can join against a VALUES list instead
+        of building CASE expressions. That isn't possible if the queryset is
+        filtered, if a field lives on a parent model's table or requires a
+        custom placeholder, or if a value is an expression.
+        """
+        if not connections[self.db].features.supports_update_from_values:
+            return False
+        if self.query.has_filters():
+            return False
+        concrete_model = self.model._meta.concrete_model
+        for field in fields:
+            if field.model._meta.concrete_model is not concrete_model or hasattr(field, 'get_placeholder'):
+                return False
+        return not any(
+            hasattr(getattr(obj, field.attname), 'resolve_expression')
+            for obj in objs for field in fields
+        )
+
     def get_or_create(self, defaults=None, **kwargs):
         """
         Look up an object with the given kwargs, creating one if necessary.
@@ -729,7 +856,8 @@ class QuerySet:
         del_query.query.clear_ordering(force_empty=True)
 
         collector = Collector(using=del_query.db)
-        collector.collect(del_query)
+        if not collector.collect_set_based(del_query):
+            collector.collect(del_query)
         deleted, _rows_count = collector.delete()
 
         # Clear the result cache, in case this QuerySet gets reused.
@@ -747,6 +875,9 @@ class QuerySet:
         query = self.query.clone()
         query.__class__ = sql.DeleteQuery
         cursor = query.get_compiler(using).execute_sql(CURSOR)
+        identity_map = get_identity_map()
+        if identity_map is not None:
+            identity_map.discard_model(self.model, using)
         return cursor.rowcount if cursor else 0
     _raw_delete.alters_data = True
 
@@ -765,6 +896,9 @@ class QuerySet:
         with transaction.mark_for_rollback_on_error(using=self.db):
             rows = query.get_compiler(self.db).execute_sql(CURSOR)
         self._result_cache = None
+        identity_map = get_identity_map()
+        if identity_map is not None:
+            identity_map.discard_model(self.model, self.db)
         return rows
     update.alters_data = True
 
@@ -786,6 +920,24 @@ class QuerySet:
     _update.alters_data = True
     _update.queryset_only = False
 
+    def _defer_update(self, values, callback):
+        """
+        Like _update(), but add the UPDATE to the connection's write batch.
+        callback is called with the number of updated rows once it has run.
+        """
+        assert not self.query.is_sliced, \
+            "Cannot update a query once a slice has been taken."
+        query = self.query.chain(sql.UpdateQuery)
+        query.add_update_fields(values)
+        query.annotations = {}
+        self._result_cache = None
+        compiler = query.get_compiler(self.db)
+        update_sql, params = compiler.as_sql()
+        connections[self.db].write_batch.add(update_sql, params, callback)
+        compiler.invalidate_cached_results()
+    _defer_update.alters_data = True
+    _defer_update.queryset_only = False
+
     def exists(self):
         if self._result_cache is None:
             return self.query.has_results(using=self.db)
@@ -1009,6 +1161,63 @@ class QuerySet:
         obj.query.select_for_update_of = of
         return obj
 
+    def seek(self, after=None, limit=None):
+        """
+        Return a new QuerySet of the rows following `after` in the ordering
+        of this QuerySet, at most `limit` of them. `after` is a model
+        instance, a dict of values(), a sequence of the values of the
+        ordering fields or a token returned by seek_token(); None starts from
+        the first row.
+
+        The ordering is completed with the primary key unless one of its
+        fields is unique. Unlike slicing, every page costs the same when the
+        ordering columns are indexed.
+        """
+        self._not_support_combined_queries('seek')
+        assert not self.query.is_sliced, \
+            "Cannot seek once a slice has been taken."
+        keyset = Keyset.from_queryset(self)
+        if after is None:
+            values = None
+        elif isinstance(after, str):
+            values = keyset.decode(after)
+        else:
+            values = keyset.get_values(after)
+        return self._seek(keyset, values, limit)
+
+    def _seek(self, keyset, values, limit):
+        clone = self._chain()
+        if values is not None:
+            clone.query.add_q(Q(keyset.get_condition(values)))
+        clone.query.clear_ordering(force_empty=True)
+        # The keyset already accounts for reverse().
+        clone.query.standard_ordering = True
+        clone.query.add_ordering(*keyset.ordering)
+        if limit is not None:
+            clone.query.set_limits(high=limit)
+        return clone
+
+    def seek_token(self, position):
+        """
+        Return an opaque token for seek(after=...) to continue after
+        position, a model instance, a dict of values() or a sequence of
+        values of the ordering fields.
+        """
+        keyset = Keyset.from_queryset(self)
+        return keyset.encode(keyset.get_values(position))
+
+    def cached(self, ttl=None):
+        """
+        Return a new QuerySet instance whose results are read through the
+        query result cache, and kept there for ttl seconds at most. Cached
+        results are discarded whenever one of the tables the query reads is
+        written.
+        """
+        obj = self._chain()
+        obj.query.cache_results = True
+        obj.query.cache_ttl = ttl
+        return obj
+
     def select_related(self, *fields):
         """
         Return a new QuerySet instance that will select related objects.
@@ -1252,6 +1461,45 @@ class QuerySet:
                 self._insert(item, fields=fields, using=self.db, ignore_conflicts=ignore_conflicts)
         return inserted_rows
 
+    def _copy_insert(self, objs, fields, batch_size):
+        """
+        Helper method for bulk_create(method='copy') to stream objs into the
+        table with COPY. Objects without a primary key get one from the
+        table's sequence first, since COPY can't return it.
+        """
+        connection = connections[self.db]
+        opts = self.model._meta
+        objs_without_pk = [obj for obj in objs if obj.pk is None]
+        if objs_without_pk and not isinstance(opts.pk, AutoField):
+            raise ValueError("bulk_create(method='copy') requires a primary key on every object.")
+
+        def rows():
+            for obj in objs:
+                row = []
+                for field in fields:
+                    value = field.pre_save(obj, add=True)
+                    if hasattr(value, 'resolve_expression'):
+                        raise ValueError(
+                            "bulk_create(method='copy') doesn't support expressions (%s=%r)."
+                            % (field.name, value)
+                        )
+                    row.append(field.get_db_prep_save(value, connection=connection))
+                yield row
+
+        with connection.cursor() as cursor:
+            if objs_without_pk:
+                cursor.execute(
+                    connection.ops.allocate_sequence_values_sql(opts.db_table, opts.pk.column),
+                    [len(objs_without_pk)],
+                )
+                for obj, (pk,) in zip(objs_without_pk, cursor.fetchall()):
+                    setattr(obj, opts.pk.attname, pk)
+            connection.ops.bulk_copy(cursor, opts.db_table, fields, rows(), batch_size)
+        query_cache.invalidate_model(self.model, self.db)
+        for obj in objs:
+            obj._state.adding = False
+            obj._state.db = self.db
+
     def _chain(self, **kwargs):
         """
         Return a copy of the current QuerySet that's ready for another
@@ -1786,25 +2034,36 @@ def prefetch_one_level(instances, prefetcher, lookup, level):
     # The 'values to be matched' must be hashable as they will be used
     # in a dictionary.
 
-    rel_qs, rel_obj_attr, instance_attr, single, cache_name, is_descriptor = (
-        prefetcher.get_prefetch_queryset(instances, lookup.get_current_queryset(level)))
-    # We have to handle the possibility that the QuerySet we just got back
-    # contains some prefetch_related lookups. We don't want to trigger the
-    # prefetch_related functionality by evaluating the query. Rather, we need
-    # to merge in the prefetch_related lookups.
-    # Copy the lookups in case it is a Prefetch object which could be reused
-    # later (happens in nested prefetch_related).
-    additional_lookups = [
-        copy.copy(additional_lookup) for additional_lookup
-        in getattr(rel_qs, '_prefetch_related_lookups', ())
-    ]
-    if additional_lookups:
-        # Don't need to clone because the manager should have given us a fresh
-        # instance, so we access an internal instead of using public interface
-        # for performance reasons.
-        rel_qs._prefetch_related_lookups = ()
-
-    all_related_objects = list(rel_qs)
+    # Backends that can't bind a whole list of values as one parameter limit
+    # the number of instances handled by each query.
+    current_queryset = lookup.get_current_queryset(level)
+    db = current_queryset.db if current_queryset is not None else instances[0]._state.db
+    batch_size = connections[db or DEFAULT_DB_ALIAS].ops.prefetch_batch_size()
+    if not batch_size:
+        batch_size = len(instances)
+    all_related_objects = []
+    additional_lookups = None
+    for offset in range(0, len(instances), batch_size):
+        rel_qs, rel_obj_attr, instance_attr, single, cache_name, is_descriptor = (
+            prefetcher.get_prefetch_queryset(instances[offset:offset + batch_size], current_queryset))
+        # We have to handle the possibility that the QuerySet we just got back
+        # contains some prefetch_related lookups. We don't want to trigger the
+        # prefetch_related functionality by evaluating the query. Rather, we need
+        # to merge in the prefetch_related lookups.
+        # Copy the lookups in case it is a Prefetch object which could be reused
+        # later (happens in nested prefetch_related).
+        if additional_lookups is None:
+            additional_lookups = [
+                copy.copy(additional_lookup) for additional_lookup
+                in getattr(rel_qs, '_prefetch_related_lookups', ())
+            ]
+        if additional_lookups:
+            # Don't need to clone because the manager should have given us a fresh
+            # instance, so we access an internal instead of using public interface
+            # for performance reasons.
+            rel_qs._prefetch_related_lookups = ()
+
+        all_related_objects.extend(rel_qs)
 
     rel_obj_cache = {}
     for rel_obj in all_related_objects:
@@ -1920,19 +2179,25 @@ class RelatedPopulator:
 
         self.model_cls = klass_info['model']
         self.pk_idx = self.init_list.index(self.model_cls._meta.pk.attname)
+        #  - pk_col, hydrate: the position of the primary key in the full
+        #    row and a callable building the instance from the full row.
+        if self.reorder_for_init:
+            self.pk_col = attname_indexes[self.model_cls._meta.pk.attname]
+            hydrate = self.model_cls._get_from_db_hydrator(db, self.init_list, 0, len(self.init_list))
+            reorder_for_init = self.reorder_for_init
+            self.hydrate = lambda row: hydrate(reorder_for_init(row))
+        else:
+            self.pk_col = self.cols_start + self.pk_idx
+            self.hydrate = self.model_cls._get_from_db_hydrator(db, self.init_list, self.cols_start, self.cols_end)
         self.related_populators = get_related_populators(klass_info, select, self.db)
         self.local_setter = klass_info['local_setter']
         self.remote_setter = klass_info['remote_setter']
 
     def populate(self, row, from_obj):
-        if self.reorder_for_init:
-            obj_data = self.reorder_for_init(row)
-        else:
-            obj_data = row[self.cols_start:self.cols_end]
-        if obj_data[self.pk_idx] is None:
+        if row[self.pk_col] is None:
             obj = None
         else:
-            obj = self.model_cls.from_db(self.db, self.init_list, obj_data)
+            obj = self.hydrate(row)
             for rel_iter in self.related_populators:
                 rel_iter.populate(row, obj)
         self.local_setter(from_obj, obj)
@@ -1940,6 +2205,73 @@ class RelatedPopulator:
             self.remote_setter(obj, from_obj)
 
 
+class RelatedPopulationPlan:
+    """
+    A flattened RelatedPopulator tree, built once per query.
+
+    The populators are laid out in depth-first order as steps of
+    (parent_slot, pk_col, hydrate, local_setter, remote_setter, subtree_end),
+    where parent_slot indexes the objects built so far for the current row
+    (0 being the row's main object) and subtree_end is the index of the first
+    step that isn't a descendant of this one. populate() walks the steps in a
+    single loop, skipping a whole subtree when the related object is missing.
+
+    If share_instances is True, related objects with the same primary key
+    are only instantiated once per result and shared between the rows that
+    reference them. Their own related objects were populated by the first
+    row, so that subtree is skipped as well.
+    """
+    def __init__(self, klass_info, select, db, share_instances=True):
+        steps = self._flatten(get_related_populators(klass_info, select, db), 0, [])
+        self.steps = [tuple(step) for step in steps]
+        self.identity_maps = [{} for step in self.steps] if share_instances else None
+
+    def __bool__(self):
+        return bool(self.steps)
+
+    @classmethod
+    def _flatten(cls, populators, parent_slot, steps):
+        for populator in populators:
+            step = [
+                parent_slot, populator.pk_col, populator.hydrate,
+                populator.local_setter, populator.remote_setter, None,
+            ]
+            steps.append(step)
+            cls._flatten(populator.related_populators, len(steps), steps)
+            step[5] = len(steps)
+        return steps
+
+    def populate(self, row, obj):
+        steps = self.steps
+        identity_maps = self.identity_maps
+        objs = [obj]
+        objs.extend(None for step in steps)
+        i, num_steps = 0, len(steps)
+        while i < num_steps:
+            parent_slot, pk_col, hydrate, local_setter, remote_setter, subtree_end = steps[i]
+            from_obj = objs[parent_slot]
+            pk = row[pk_col]
+            if pk is None:
+                local_setter(from_obj, None)
+                i = subtree_end
+                continue
+            if identity_maps is None:
+                rel_obj = hydrate(row)
+                next_step = i + 1
+            else:
+                identity_map = identity_maps[i]
+                try:
+                    rel_obj = identity_map[pk]
+                    next_step = subtree_end
+                except KeyError:
+                    rel_obj = identity_map[pk] = hydrate(row)
+                    next_step = i + 1
+            objs[i + 1] = rel_obj
+            local_setter(from_obj, rel_obj)
+            remote_setter(rel_obj, from_obj)
+            i = next_step
+
+
 def get_related_populators(klass_info, select, db):
     iterators = []
     related_klass_infos = klass_info.get('related_klass_infos', [])
@@ -0,0 +1,273 @@
+"""
+Read-through cache of query results, used by QuerySet.cached().
+
+Results are stored as the raw row tuples returned by the database, keyed by
+a fingerprint of the database alias, the compiled SQL, its parameters and
+the current version of every table the query reads. Writing to a table
+bumps its version, which makes every cached result depending on it
+unreachable; stale entries then age out of the store.
+
+Writes are tracked through the SQL compilers (save(), update(), delete(),
+bulk operations, many-to-many changes) and the post_save signal. There are
+no post_delete or m2m_changed receivers since their mere presence disables
+fast deletes and fast many-to-many additions; the compilers already see
+those writes.
+
+Inside a transaction, the written tables bypass the cache until the
+transaction ends, and their version is bumped again on commit so that
+results cached by other threads in the meantime are discarded.
+
+Versions are kept per process: a store shared between processes doesn't
+see the writes of the others. Tables only referenced in raw SQL (RawSQL,
+extra(where=...)) aren't tracked either.
+"""
+import hashlib
+import sys
+import threading
+import time
+from collections import OrderedDict
+
+from django.db import connections
+from django.db.models import signals
+
+# Default size of the in-process store, in bytes.
+DEFAULT_MAX_BYTES = 32 * 1024 * 1024
+
+
+def estimate_size(rows):
+    """Return an estimate of the memory used by a tuple of row tuples."""
+    size = sys.getsizeof(rows)
+    for row in rows:
+        size += sys.getsizeof(row)
+        for value in row:
+            size += sys.getsizeof(value)
+    return size
+
+
+class BaseStore:
+    """
+    Interface of the result stores. Keys are strings, values are tuples of
+    row tuples.
+    """
+    def get(self, key):
+        """Return the value for key, or None if it's missing or expired."""
+        raise NotImplementedError('subclasses of BaseStore must provide a get() method')
+
+    def set(self, key, value, ttl=None):
+        """Store value for key, for ttl seconds or until it's evicted."""
+        raise NotImplementedError('subclasses of BaseStore must provide a set() method')
+
+    def delete(self, key):
+        raise NotImplementedError('subclasses of BaseStore must provide a delete() method')
+
+    def clear(self):
+        raise NotImplementedError('subclasses of BaseStore must provide a clear() method')
+
+
+class LRUStore(BaseStore):
+    """
+    In-process store evicting the least recently used values once their
+    estimated size exceeds max_bytes.
+    """
+    def __init__(self, max_bytes=DEFAULT_MAX_BYTES):
+        self.max_bytes = max_bytes
+        self.size = 0
+        self.evictions = 0
+        self._entries = OrderedDict()
+        self._lock = threading.Lock()
+
+    def __len__(self):
+        return len(self._entries)
+
+    def get(self, key):
+        with self._lock:
+            try:
+                value, size, expires = self._entries[key]
+            except KeyError:
+                return None
+            if expires is not None and expires <= time.monotonic():
+                del self._entries[key]
+                self.size -= size
+                return None
+            self._entries.move_to_end(key)
+            return value
+
+    def set(self, key, value, ttl=None):
+        size = estimate_size(value)
+        if size > self.max_bytes:
+            return
+        expires = None if ttl is None else time.monotonic() + ttl
+        with self._lock:
+            old = self._entries.pop(key, None)
+            if old is not None:
+                self.size -= old[1]
+            self._entries[key] = (value, size, expires)
+            self.size += size
+            while self.size > self.max_bytes:
+                _, (_, evicted_size, _) = self._entries.popitem(last=False)
+                self.size -= evicted_size
+                self.evictions += 1
+
+    def delete(self, key):
+        with self._lock:
+            entry = self._entries.pop(key, None)
+            if entry is not None:
+                self.size -= entry[1]
+
+    def clear(self):
+        with self._lock:
+            self._entries.clear()
+            self.size = 0
+
+
+def get_query_tables(query):
+    """Return the set of tables read by query, including its subqueries."""
+    tables = set()
+    _collect_tables(query, tables, set())
+    return tables
+
+
+def _collect_tables(node, tables, seen):
+    if node is None or isinstance(node, (str, bytes, int, float)) or id(node) in seen:
+        return
+    seen.add(id(node))
+    if isinstance(node, (list, tuple)):
+        for child in node:
+            _collect_tables(child, tables, seen)
+        return
+    alias_map = getattr(node, 'alias_map', None)
+    if alias_map is not None:
+        # A Query.
+        tables.update(join.table_name for join in alias_map.values())
+        tables.update(node.extra_tables)
+        _collect_tables(node.where, tables, seen)
+        _collect_tables(list(node.annotations.values()), tables, seen)
+        _collect_tables(node.combined_queries, tables, seen)
+        return
+    if hasattr(node, 'children'):
+        # A WhereNode.
+        _collect_tables(node.children, tables, seen)
+        return
+    # Subquery, Exists and querysets used as values.
+    _collect_tables(getattr(node, 'query', None), tables, seen)
+    # Lookups.
+    _collect_tables(getattr(node, 'lhs', None), tables, seen)
+    _collect_tables(getattr(node, 'rhs', None), tables, seen)
+    if hasattr(node, 'get_source_expressions'):
+        _collect_tables(node.get_source_expressions(), tables, seen)
+
+
+class QueryCache:
+    def __init__(self, store=None):
+        self.store = LRUStore() if store is None else store
+        self._versions = {}
+        self._lock = threading.Lock()
+        # Tables written by the transaction in progress on each connection
+        # of the current thread: {alias: (run_on_commit, tables)}.
+        self._local = threading.local()
+        self.reset_stats()
+
+    def reset_stats(self):
+        self.hits = self.misses = self.stores = self.invalidations = 0
+
+    def stats(self):
+        stats = {
+            'hits': self.hits,
+            'misses': self.misses,
+            'stores': self.stores,
+            'invalidations': self.invalidations,
+        }
+        if hasattr(self.store, 'evictions'):
+            stats['evictions'] = self.store.evictions
+        return stats
+
+    def set_store(self, store):
+        self.store = store
+
+    def clear(self):
+        self.store.clear()
+
+    def _written_tables(self, using):
+        """
+        Return the set of tables written by the transaction in progress on
+        the connection, or None outside of a transaction.
+        """
+        connection = connections[using]
+        pending = getattr(self._local, 'pending', None)
+        if pending is None:
+            pending = self._local.pending = {}
+        entry = pending.get(using)
+        # run_on_commit is replaced when the transaction ends, or a savepoint
+        # holding commit hooks is rolled back.
+        if entry is None or entry[0] is not connection.run_on_commit:
+            if not connection.in_atomic_block:
+                pending.pop(using, None)
+                return None
+            entry = pending[using] = (connection.run_on_commit, set())
+        return entry[1]
+
+    def make_key(self, using, sql, params, tables):
+        with self._lock:
+            versions = sorted((table, self._versions.get((using, table), 0)) for table in tables)
+        fingerprint = repr((using, sql, tuple(params), versions)).encode()
+        return hashlib.sha1(fingerprint).hexdigest()
+
+    def fetch(self, using, sql, params, tables, fetch_rows, ttl=None):
+        """
+        Return the rows of the query, from the store or from fetch_rows()
+        and then saved in the store for ttl seconds.
+        """
+        written = self._written_tables(using)
+        if written and not written.isdisjoint(tables):
+            # Results may depend on uncommitted writes.
+            return tuple(fetch_rows())
+        key = self.make_key(using, sql, params, tables)
+        rows = self.store.get(key)
+        if rows is not None:
+            self.hits += 1
+            return rows
+        self.misses += 1
+        rows = tuple(fetch_rows())
+        self.store.set(key, rows, ttl)
+        self.stores += 1
+        return rows
+
+    def _bump(self, using, tables):
+        with self._lock:
+            for table in tables:
+                key = (using, table)
+                self._versions[key] = self._versions.get(key, 0) + 1
+                self.invalidations += 1
+
+    def invalidate(self, using, tables):
+        """
+        Discard the cached results reading any of tables. In a transaction,
+        the tables bypass the cache until it ends and are invalidated again
+        on commit.
+        """
+        self._bump(using, tables)
+        written = self._written_tables(using)
+        if written is None:
+            return
+        new_tables = set(tables) - written
+        if new_tables:
+            written.update(new_tables)
+            connections[using].on_commit(lambda: self._bump(using, new_tables))
+
+    def invalidate_model(self, model, using):
+        opts = model._meta.concrete_model._meta
+        self.invalidate(using, [opts.db_table] + [parent._meta.db_table for parent in opts.get_parent_list()])
+
+
+query_cache = QueryCache()
+
+# Results of count(approximate=True), kept for the APPROXIMATE_COUNT_TIMEOUT
+# of the database regardless of writes since they're estimates anyway.
+approximate_counts = LRUStore(max_bytes=1024 * 1024)
+
+
+def model_saved(sender, using, **kwargs):
+    query_cache.invalidate_model(sender, using)
+
+
+signals.post_save.connect(model_saved, weak=False, dispatch_uid='django.db.models.query_cache.post_save')
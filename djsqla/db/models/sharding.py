@@ -0,0 +1,513 @@
+"""
+Horizontal sharding of the rows of a model across databases.
+
+A model declares its shard key through a ShardedManager:
+
+    class Order(models.Model):
+        tenant_id = models.IntegerField()
+        ...
+
+        objects = ShardedManager(HashSharding('tenant_id', ['shard0', 'shard1']))
+
+Querysets of the manager restricted to shard key values with exact or
+__in lookups run on the shards of these values. Other queries fan out to
+every shard in parallel and their results are merged: in the order of
+order_by() (by comparing the values in Python), then sliced. count(),
+exists(), aggregate() with Count/Sum/Min/Max/Avg, update() and delete()
+combine the results of each shard. create(), bulk_create() and
+bulk_update() write each instance to the shard of its key, and
+get_or_create() and update_or_create() require the shard key among their
+lookups; add ShardRouter to DATABASE_ROUTERS so that Model.save() and
+Model.delete() do too.
+
+Outside of transactions, the queries of a fan-out run in threads with
+connections of their own, closed afterwards according to CONN_MAX_AGE.
+Inside an atomic block on one of the shards, they run one after the other
+on the connections of the current thread so that they see its writes.
+
+Rows related to a sharded row are expected to live on the same shard.
+Primary keys must be unique across shards.
+"""
+import bisect
+import heapq
+import zlib
+from concurrent.futures import ThreadPoolExecutor
+from itertools import islice
+
+from django.db import connections
+from django.db.models import aggregates
+from django.db.models.constants import LOOKUP_SEP
+from django.db.models.expressions import Col, F, OrderBy
+from django.db.models.lookups import Lookup
+from django.db.models.manager import BaseManager
+from django.db.models.query import (
+    FlatValuesListIterable, ModelIterable, NamedValuesListIterable, QuerySet,
+    ValuesIterable, ValuesListIterable,
+)
+from django.db.models.sql.where import AND, OR, WhereNode
+from django.db.utils import NotSupportedError
+
+
+class Sharding:
+    """
+    Map the values of the shard key field_name to the aliases of the
+    databases holding their rows.
+    """
+    def __init__(self, field_name, shards):
+        self.field_name = field_name
+        self.shards = list(shards)
+        self._executor = None
+
+    def get_shard(self, value):
+        """Return the alias of the database holding the rows of value."""
+        raise NotImplementedError('subclasses of Sharding must provide a get_shard() method')
+
+    def get_instance_shard(self, instance):
+        return self.get_shard(getattr(instance, instance._meta.get_field(self.field_name).attname))
+
+    @property
+    def executor(self):
+        if self._executor is None:
+            self._executor = ThreadPoolExecutor(max_workers=len(self.shards), thread_name_prefix='django-shard')
+        return self._executor
+
+
+class HashSharding(Sharding):
+    """
+    Spread the values of the shard key over the shards by hash. The
+    default hash, a CRC32 of the string of the value, is stable across
+    processes; hash can be any function of the value returning an integer.
+    """
+    def __init__(self, field_name, shards, hash=None):
+        super().__init__(field_name, shards)
+        self.hash = hash or self.crc32
+
+    @staticmethod
+    def crc32(value):
+        return zlib.crc32(str(value).encode())
+
+    def get_shard(self, value):
+        return self.shards[self.hash(value) % len(self.shards)]
+
+
+class RangeSharding(Sharding):
+    """
+    Assign ranges of values of the shard key to the shards. ranges is a
+    list of (upper bound, alias) pairs in increasing order of bounds; each
+    shard holds the values under its bound and from the previous one up.
+    The last bound may be None for values above all others.
+    """
+    def __init__(self, field_name, ranges):
+        super().__init__(field_name, [alias for bound, alias in ranges])
+        self.bounds = [bound for bound, alias in ranges if bound is not None]
+
+    def get_shard(self, value):
+        index = bisect.bisect_right(self.bounds, value)
+        if index == len(self.shards):
+            raise ValueError('%r is above the ranges of %s.' % (value, self.field_name))
+        return self.shards[index]
+
+
+def _shard_key_values(node, field, alias):
+    """
+    Return the set of shard key values the where node restricts the rows
+    to, or None if it doesn't.
+    """
+    if isinstance(node, WhereNode):
+        if node.negated:
+            return None
+        children = [_shard_key_values(child, field, alias) for child in node.children]
+        if node.connector == AND:
+            restricted = [values for values in children if values is not None]
+            return set.intersection(*restricted) if restricted else None
+        if node.connector == OR and children and None not in children:
+            return set.union(*children)
+        return None
+    if not isinstance(node, Lookup) or not isinstance(node.lhs, Col):
+        return None
+    if node.lhs.target != field or node.lhs.alias != alias:
+        return None
+    if node.lookup_name == 'exact':
+        values = [node.rhs]
+    elif node.lookup_name == 'in' and isinstance(node.rhs, (list, tuple, set, frozenset)):
+        values = node.rhs
+    else:
+        return None
+    if any(hasattr(value, 'resolve_expression') for value in values):
+        return None
+    return {value.pk if hasattr(value, '_meta') else value for value in values}
+
+
+class _MergeKey:
+    """
+    Sort key of a row comparing its ordering values, each in ascending or
+    descending order with NULLs first or last.
+    """
+    __slots__ = ('values', 'descending', 'nulls_first')
+
+    def __init__(self, values, descending, nulls_first):
+        self.values = values
+        self.descending = descending
+        self.nulls_first = nulls_first
+
+    def __lt__(self, other):
+        for value, other_value, descending, nulls_first in zip(
+                self.values, other.values, self.descending, self.nulls_first):
+            if value == other_value:
+                continue
+            if value is None:
+                return nulls_first
+            if other_value is None:
+                return not nulls_first
+            return value > other_value if descending else value < other_value
+        return False
+
+
+def _run_on_shard(func, alias):
+    try:
+        return func(alias)
+    finally:
+        connections[alias].close_if_unusable_or_obsolete()
+
+
+class ShardedQuerySet(QuerySet):
+    """QuerySet running on the shards its shard key filters select."""
+
+    # Aggregates whose results combine across shards.
+    merged_aggregates = {
+        aggregates.Count: sum,
+        aggregates.Sum: sum,
+        aggregates.Max: max,
+        aggregates.Min: min,
+    }
+
+    @property
+    def sharding(self):
+        return self.model._meta.sharding
+
+    def get_shards(self):
+        """Return the aliases of the databases the queryset runs on."""
+        if self._db is not None:
+            return [self._db]
+        query = self.query
+        values = _shard_key_values(
+            query.where, self.model._meta.get_field(self.sharding.field_name), query.base_table,
+        )
+        if values is None:
+            return list(self.sharding.shards)
+        shards = {self.sharding.get_shard(value) for value in values}
+        return [alias for alias in self.sharding.shards if alias in shards]
+
+    @property
+    def db(self):
+        if self._db is None:
+            shards = self.get_shards()
+            if len(shards) == 1:
+                return shards[0]
+        return super().db
+
+    def _map_shards(self, func, shards=None):
+        """Return [func(alias) for alias in shards], run in parallel."""
+        if shards is None:
+            shards = self.get_shards()
+        if len(shards) < 2 or any(connections[alias].in_atomic_block for alias in shards):
+            return [func(alias) for alias in shards]
+        return list(self.sharding.executor.map(_run_on_shard, [func] * len(shards), shards))
+
+    def _fans_out(self):
+        return self._db is None and len(self.get_shards()) != 1
+
+    def _fetch_all(self):
+        if self._result_cache is None and self._fans_out():
+            self._result_cache = self._fetch_fan_out()
+        super()._fetch_all()
+
+    def _check_fan_out_rows(self):
+        """
+        Raise NotSupportedError if the rows of the shards can't be combined
+        as they are: the same distinct or grouped values() rows may come
+        from several shards.
+        """
+        if self._fields is not None and (self.query.distinct or self.query.group_by is not None):
+            raise NotSupportedError('distinct() and aggregation on values() cannot be combined across shards.')
+
+    def _fetch_fan_out(self):
+        self._check_fan_out_rows()
+        query = self.query
+        low, high = query.low_mark, query.high_mark
+
+        def fetch(alias):
+            queryset = self.using(alias)
+            queryset.query.clear_limits()
+            if high is not None:
+                # The first high rows of the merged results are among the
+                # first high rows of each shard.
+                queryset.query.set_limits(high=high)
+            return list(queryset)
+
+        results = self._map_shards(fetch)
+        key = self._get_merge_key()
+        merged = heapq.merge(*results, key=key) if key else (row for rows in results for row in rows)
+        return list(islice(merged, low, high))
+
+    def _get_merge_key(self):
+        query = self.query
+        if query.extra_order_by:
+            raise NotSupportedError('extra(order_by=...) cannot be merged across shards.')
+        ordering = query.order_by or (self.model._meta.ordering if query.default_ordering else ())
+        # Where NULLs come in the results of the shards, unless the ordering
+        # places them explicitly.
+        nulls_largest = {connections[alias].features.nulls_order_largest for alias in self.get_shards()}
+        getters = []
+        descending = []
+        nulls_first = []
+        for item in ordering:
+            nulls = None
+            if isinstance(item, OrderBy) and isinstance(item.expression, F):
+                path, desc = item.expression.name, item.descending
+                if item.nulls_first or item.nulls_last:
+                    nulls = item.nulls_first
+            elif isinstance(item, F):
+                path, desc = item.name, False
+            elif isinstance(item, str) and item != '?':
+                path, desc = item.lstrip('-'), item.startswith('-')
+            else:
+                raise NotSupportedError('Results ordered by %r cannot be merged across shards.' % (item,))
+            getters.append(self._get_value_getter(path))
+            if not query.standard_ordering:
+                # Reversing an ordering moves the NULLs to the other end.
+                desc = not desc
+                if nulls is not None:
+                    nulls = not nulls
+            if nulls is None:
+                if len(nulls_largest) != 1:
+                    raise NotSupportedError(
+                        'Results ordered by %r cannot be merged across shards that sort '
+                        'NULLs differently, use nulls_first or nulls_last.' % path
+                    )
+                nulls = desc == next(iter(nulls_largest))
+            descending.append(desc)
+            nulls_first.append(nulls)
+        if not getters:
+            return None
+        return lambda row: _MergeKey([getter(row) for getter in getters], descending, nulls_first)
+
+    def _get_value_getter(self, path):
+        query = self.query
+        names = path.split(LOOKUP_SEP)
+        if names[0] not in query.annotations and names[0] not in query.extra_select:
+            path_infos, final_field, targets, rest = query.names_to_path(
+                names, self.model._meta, fail_on_missing=True,
+            )
+            if (final_field.is_relation and names[-1] not in (final_field.attname, 'pk') and
+                    final_field.related_model._meta.ordering):
+                raise NotSupportedError(
+                    'Results ordered by %r use the ordering of the related model and '
+                    'cannot be merged across shards, order by its fields instead.' % path
+                )
+            if self._iterable_class is ModelIterable:
+                # Relations compare by the value of their column.
+                names[-1] = final_field.attname
+        if self._iterable_class is ModelIterable:
+            def getter(obj):
+                for name in names:
+                    obj = getattr(obj, name)
+                return obj
+            return getter
+        names = [*query.extra_select, *query.values_select, *query.annotation_select]
+        if path not in names:
+            raise NotSupportedError(
+                'Results ordered by %r cannot be merged across shards unless it is '
+                'selected by values() or values_list().' % path
+            )
+        if self._iterable_class is ValuesIterable:
+            return lambda row: row[path]
+        if self._iterable_class is FlatValuesListIterable:
+            return lambda value: value
+        if self._iterable_class in (ValuesListIterable, NamedValuesListIterable):
+            if self._fields:
+                # values_list() returns the fields in the order they were given.
+                names = [*self._fields, *(name for name in query.annotation_select if name not in self._fields)]
+            index = names.index(path)
+            return lambda row: row[index]
+        raise NotSupportedError('%s results cannot be merged across shards.' % self._iterable_class.__name__)
+
+    def iterator(self, chunk_size=2000):
+        if self._fans_out():
+            return iter(self._fetch_fan_out())
+        return super().iterator(chunk_size)
+
+    def count(self, *, approximate=None):
+        if self._result_cache is None and self._fans_out():
+            self._check_fan_out_rows()
+            query = self.query
+            low, high = query.low_mark, query.high_mark
+
+            def count(alias):
+                # The slice applies to the merged rows.
+                queryset = self.using(alias)
+                queryset.query.clear_limits()
+                return queryset.count(approximate=approximate)
+
+            number = max(sum(self._map_shards(count)) - low, 0)
+            return number if high is None else min(number, high - low)
+        return super().count(approximate=approximate)
+
+    def exists(self):
+        if self._result_cache is None and self._fans_out():
+            if self.query.is_sliced:
+                return self.count() > 0
+            return any(self._map_shards(lambda alias: self.using(alias).exists()))
+        return super().exists()
+
+    def aggregate(self, *args, **kwargs):
+        if not self._fans_out():
+            return super().aggregate(*args, **kwargs)
+        if self.query.is_sliced:
+            raise NotSupportedError('aggregate() of a sliced queryset cannot be combined across shards.')
+        self._check_fan_out_rows()
+        for arg in args:
+            try:
+                kwargs[arg.default_alias] = arg
+            except (AttributeError, TypeError):
+                raise TypeError("Complex aggregates require an alias")
+        shard_kwargs = {}
+        for alias, aggregate in kwargs.items():
+            if getattr(aggregate, 'distinct', False):
+                raise NotSupportedError('Distinct aggregates cannot be combined across shards.')
+            if isinstance(aggregate, aggregates.Avg):
+                # Averaged from the sum and the count of each shard.
+                sources = aggregate.source_expressions
+                shard_kwargs['%s__sum' % alias] = aggregates.Sum(*sources, filter=aggregate.filter)
+                shard_kwargs['%s__count' % alias] = aggregates.Count(*sources, filter=aggregate.filter)
+            elif type(aggregate) in self.merged_aggregates:
+                shard_kwargs[alias] = aggregate
+            else:
+                raise NotSupportedError('%r cannot be aggregated across shards.' % aggregate)
+        results = self._map_shards(lambda alias: self.using(alias).aggregate(**shard_kwargs))
+
+        def combine(alias):
+            values = [result[alias] for result in results if result[alias] is not None]
+            if not values:
+                return 0 if isinstance(kwargs.get(alias), aggregates.Count) else None
+            return self.merged_aggregates[type(shard_kwargs[alias])](values)
+
+        merged = {}
+        for alias, aggregate in kwargs.items():
+            if isinstance(aggregate, aggregates.Avg):
+                total, number = combine('%s__sum' % alias), combine('%s__count' % alias)
+                merged[alias] = total / number if number else None
+            else:
+                merged[alias] = combine(alias)
+        return merged
+
+    def create(self, **kwargs):
+        if self._db is not None:
+            return super().create(**kwargs)
+        obj = self.model(**kwargs)
+        self._for_write = True
+        obj.save(force_insert=True, using=self.sharding.get_instance_shard(obj))
+        return obj
+
+    def bulk_create(self, objs, batch_size=None, ignore_conflicts=False, method='insert'):
+        if self._db is not None:
+            return super().bulk_create(objs, batch_size, ignore_conflicts, method)
+        objs = list(objs)
+        by_shard = {}
+        for obj in objs:
+            by_shard.setdefault(self.sharding.get_instance_shard(obj), []).append(obj)
+        for alias, shard_objs in by_shard.items():
+            self.using(alias).bulk_create(shard_objs, batch_size, ignore_conflicts, method)
+        return objs
+
+    def bulk_update(self, objs, fields, batch_size=None):
+        if self._db is not None:
+            return super().bulk_update(objs, fields, batch_size)
+        if self.sharding.field_name in fields:
+            raise NotSupportedError("bulk_update() cannot change the shard key, rows wouldn't move across shards.")
+        by_shard = {}
+        for obj in objs:
+            by_shard.setdefault(self.sharding.get_instance_shard(obj), []).append(obj)
+        for alias, shard_objs in by_shard.items():
+            self.using(alias).bulk_update(shard_objs, fields, batch_size)
+    bulk_update.alters_data = True
+
+    def _get_lookup_shard(self, method, kwargs):
+        """
+        Return the alias of the shard get_or_create() or update_or_create()
+        look up the kwargs on, so that their transaction runs there.
+        """
+        shards = self.filter(**kwargs).get_shards()
+        if len(shards) != 1:
+            raise NotSupportedError(
+                '%s() requires a lookup on the shard key %r across shards.'
+                % (method, self.sharding.field_name)
+            )
+        return shards[0]
+
+    def get_or_create(self, defaults=None, **kwargs):
+        if self._db is not None:
+            return super().get_or_create(defaults, **kwargs)
+        return self.using(self._get_lookup_shard('get_or_create', kwargs)).get_or_create(defaults, **kwargs)
+
+    def update_or_create(self, defaults=None, **kwargs):
+        if self._db is not None:
+            return super().update_or_create(defaults, **kwargs)
+        return self.using(self._get_lookup_shard('update_or_create', kwargs)).update_or_create(defaults, **kwargs)
+
+    def update(self, **kwargs):
+        if self._db is None and self.sharding.field_name in kwargs:
+            raise NotSupportedError("update() cannot change the shard key, rows wouldn't move across shards.")
+        if not self._fans_out():
+            return super().update(**kwargs)
+        self._result_cache = None
+        return sum(self._map_shards(lambda alias: self.using(alias).update(**kwargs)))
+    update.alters_data = True
+
+    def delete(self):
+        if not self._fans_out():
+            return super().delete()
+        self._result_cache = None
+        deleted, rows_count = 0, {}
+        for shard_deleted, shard_rows_count in self._map_shards(lambda alias: self.using(alias).delete()):
+            deleted += shard_deleted
+            for label, number in shard_rows_count.items():
+                rows_count[label] = rows_count.get(label, 0) + number
+        return deleted, rows_count
+    delete.alters_data = True
+    delete.queryset_only = True
+
+
+class ShardedManager(BaseManager.from_queryset(ShardedQuerySet)):
+    """
+    Manager declaring the shard key of its model, see Sharding. Managers
+    created without sharding, such as related managers, use the one the
+    model already declares.
+    """
+    def __init__(self, sharding=None):
+        super().__init__()
+        self.sharding = sharding
+
+    def contribute_to_class(self, model, name):
+        super().contribute_to_class(model, name)
+        if self.sharding is not None:
+            model._meta.sharding = self.sharding
+
+
+class ShardRouter:
+    """
+    Database router sending the reads and writes bound to an instance of a
+    sharded model to its shard, e.g. Model.save() and Model.delete().
+    """
+    def _instance_shard(self, model, hints):
+        sharding = model._meta.sharding
+        instance = hints.get('instance')
+        if sharding is None or not isinstance(instance, model):
+            return None
+        return sharding.get_instance_shard(instance)
+
+    def db_for_read(self, model, **hints):
+        return self._instance_shard(model, hints)
+
+    def db_for_write(self, model, **hints):
+        return self._instance_shard(model, hints)
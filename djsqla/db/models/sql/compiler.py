@@ -1,12 +1,13 @@
 import collections
 import re
 from functools import partial
-from itertools import chain
+from itertools import chain, islice
 
 from django.core.exceptions import EmptyResultSet, FieldError
 from django.db.models.constants import LOOKUP_SEP
 from django.db.models.expressions import OrderBy, Random, RawSQL, Ref, Value
 from django.db.models.functions import Cast
+from django.db.models.query_cache import get_query_tables, query_cache
 from django.db.models.query_utils import Q, select_related_descend
 from django.db.models.sql.constants import (
     CURSOR, GET_ITERATOR_CHUNK_SIZE, MULTI, NO_RESULTS, ORDER_DIR, SINGLE,
@@ -1027,30 +1028,58 @@ class SQLCompiler:
                     converters[i] = (backend_converters + field_converters, expression)
         return converters
 
-    def apply_converters(self, rows, converters):
+    def compile_converters(self, converters):
+        """
+        Fuse the converters returned by get_converters() into a list of
+        (position, converter) pairs where each converter takes only a value.
+        Backends may substitute native processors for individual converters.
+        """
         connection = self.connection
-        converters = list(converters.items())
-        for row in map(list, rows):
-            for pos, (convs, expression) in converters:
-                value = row[pos]
-                for converter in convs:
-                    value = converter(value, expression, connection)
-                row[pos] = value
-            yield row
+        compiled = []
+        for pos, (convs, expression) in converters.items():
+            processors = []
+            for converter in convs:
+                processor = connection.ops.get_db_converter_processor(converter, expression)
+                if processor is None:
+                    processor = partial(_call_converter, converter, expression, connection)
+                processors.append(processor)
+            compiled.append((pos, _fuse_processors(processors)))
+        return compiled
+
+    @staticmethod
+    def convert_rows(rows, compiled_converters):
+        """
+        Apply compiled converters column by column to a list of rows and
+        return an iterator of row tuples.
+        """
+        columns = list(zip(*rows))
+        if not columns:
+            return iter(rows)
+        for pos, converter in compiled_converters:
+            columns[pos] = map(converter, columns[pos])
+        return zip(*columns)
+
+    def apply_converters(self, rows, converters):
+        compiled_converters = self.compile_converters(converters)
+        rows = iter(rows)
+        for chunk in iter(lambda: list(islice(rows, GET_ITERATOR_CHUNK_SIZE)), []):
+            yield from self.convert_rows(chunk, compiled_converters)
 
     def results_iter(self, results=None, tuple_expected=False, chunked_fetch=False,
                      chunk_size=GET_ITERATOR_CHUNK_SIZE):
-        """Return an iterator over the results from executing this query."""
+        """
+        Return an iterator over the results from executing this query. Rows
+        are always tuples, tuple_expected is kept for backwards compatibility.
+        """
         if results is None:
             results = self.execute_sql(MULTI, chunked_fetch=chunked_fetch, chunk_size=chunk_size)
         fields = [s[0] for s in self.select[0:self.col_count]]
         converters = self.get_converters(fields)
-        rows = chain.from_iterable(results)
         if converters:
-            rows = self.apply_converters(rows, converters)
-            if tuple_expected:
-                rows = map(tuple, rows)
-        return rows
+            compiled_converters = self.compile_converters(converters)
+            convert_rows = self.convert_rows
+            return chain.from_iterable(convert_rows(rows, compiled_converters) for rows in results)
+        return chain.from_iterable(results)
 
     def has_results(self):
         """
@@ -1085,6 +1114,15 @@ class SQLCompiler:
                 return iter([])
             else:
                 return
+        if (self.query.cache_results and result_type in (MULTI, SINGLE) and
+                not self.query.select_for_update and not self.query.explain_query):
+            rows = query_cache.fetch(
+                self.using, sql, params, get_query_tables(self.query),
+                partial(self.fetch_rows, sql, params), self.query.cache_ttl,
+            )
+            if result_type == SINGLE:
+                return rows[0] if rows else None
+            return [rows]
         if chunked_fetch:
             cursor = self.connection.chunked_cursor()
         else:
@@ -1129,6 +1167,19 @@ class SQLCompiler:
                 cursor.close()
         return result
 
+    def fetch_rows(self, sql, params):
+        """
+        Return all the rows of the query as tuples, stripped of the columns
+        only selected for ordering. Used to fill the query result cache.
+        """
+        with self.connection.cursor() as cursor:
+            cursor.execute(sql, params)
+            return [tuple(row[0:self.col_count]) for row in cursor.fetchall()]
+
+    def invalidate_cached_results(self):
+        """Discard the cached results reading the table written by the query."""
+        query_cache.invalidate_model(self.query.model, self.using)
+
     def as_subquery_condition(self, alias, columns, compiler):
         qn = compiler.quote_name_unless_alias
         qn2 = self.connection.ops.quote_name
@@ -1332,6 +1383,7 @@ class SQLInsertCompiler(SQLCompiler):
         with self.connection.cursor() as cursor:
             for sql, params in self.as_sql():
                 cursor.execute(sql, params)
+            self.invalidate_cached_results()
             if not self.returning_fields:
                 return []
             if self.connection.features.can_return_rows_from_bulk_insert and len(self.query.objs) > 1:
@@ -1344,6 +1396,41 @@ class SQLInsertCompiler(SQLCompiler):
             )]
 
 
+class SQLBulkUpdateCompiler(SQLCompiler):
+    def as_sql(self):
+        """
+        Create the SQL for this query. Return the SQL string and list of
+        parameters.
+        """
+        query = self.query
+        connection = self.connection
+        opts = query.get_meta()
+        fields = [opts.pk, *query.fields]
+        num_objs = len(query.objs)
+        try:
+            sql = query.sql_cache[num_objs]
+        except KeyError:
+            if connection.features.requires_casted_case_in_updates:
+                placeholders = ['CAST(%%s AS %s)' % field.cast_db_type(connection) for field in fields]
+            else:
+                placeholders = ['%s'] * len(fields)
+            sql = query.sql_cache[num_objs] = connection.ops.bulk_update_from_values_sql(
+                opts.db_table, opts.pk.column, [field.column for field in query.fields],
+                [placeholders] * num_objs,
+            )
+        params = [
+            field.get_db_prep_save(getattr(obj, field.attname), connection=connection)
+            for obj in query.objs
+            for field in fields
+        ]
+        return sql, tuple(params)
+
+    def execute_sql(self, result_type=MULTI, **kwargs):
+        cursor = super().execute_sql(result_type, **kwargs)
+        self.invalidate_cached_results()
+        return cursor
+
+
 class SQLDeleteCompiler(SQLCompiler):
     @cached_property
     def single_alias(self):
@@ -1377,6 +1464,11 @@ class SQLDeleteCompiler(SQLCompiler):
         outerq.add_q(Q(pk__in=innerq))
         return self._as_sql(outerq)
 
+    def execute_sql(self, result_type=MULTI, **kwargs):
+        cursor = super().execute_sql(result_type, **kwargs)
+        self.invalidate_cached_results()
+        return cursor
+
 
 class SQLUpdateCompiler(SQLCompiler):
     def as_sql(self):
@@ -1450,6 +1542,7 @@ class SQLUpdateCompiler(SQLCompiler):
         related queries are not available.
         """
         cursor = super().execute_sql(result_type)
+        self.invalidate_cached_results()
         try:
             rows = cursor.rowcount if cursor else 0
             is_empty = cursor is None
@@ -1527,6 +1620,21 @@ class SQLAggregateCompiler(SQLCompiler):
         return sql, params
 
 
+def _call_converter(converter, expression, connection, value):
+    return converter(value, expression, connection)
+
+
+def _fuse_processors(processors):
+    if len(processors) == 1:
+        return processors[0]
+
+    def processor(value):
+        for process in processors:
+            value = process(value)
+        return value
+    return processor
+
+
 def cursor_iter(cursor, sentinel, col_count, itersize):
     """
     Yield blocks of rows from a cursor and ensure the cursor is closed when
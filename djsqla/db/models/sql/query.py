@@ -9,6 +9,7 @@ all about the internals of models in order to get the information it needs.
 import copy
 import difflib
 import functools
+import hashlib
 import inspect
 import sys
 import warnings
@@ -27,6 +28,7 @@ from django.db.models.expressions import BaseExpression, Col, F, OuterRef, Ref
 from django.db.models.fields import Field
 from django.db.models.fields.related_lookups import MultiColSource
 from django.db.models.lookups import Lookup
+from django.db.models.query_cache import approximate_counts
 from django.db.models.query_utils import (
     Q, check_rel_lookup_compatibility, refs_expression,
 )
@@ -143,6 +145,19 @@ class Query(BaseExpression):
 
     compiler = 'SQLCompiler'
 
+    # Whether __in lookups against lists of values should render SQL that
+    # doesn't depend on the number of values. Set for prefetch_related().
+    bind_in_lists = False
+
+    # Whether the results are served from the query result cache when
+    # possible, and for how many seconds they are kept. Set by cached().
+    cache_results = False
+    cache_ttl = None
+
+    # Whether count() returns an estimate from the statistics of the
+    # database for large results. Set by managers with approximate_count.
+    approximate_count = False
+
     def __init__(self, model, where=WhereNode, alias_cols=True):
         self.model = model
         self.alias_refcount = {}
@@ -517,6 +532,42 @@ class Query(BaseExpression):
             number = 0
         return number
 
+    def get_approximate_count(self, using):
+        """
+        Return the number of rows of an unfiltered query estimated from the
+        statistics of the table, or that of another query estimated by the
+        query planner. Fall back to get_count() when there's no estimate or
+        when it's under the APPROXIMATE_COUNT_THRESHOLD of the database, where
+        counting is cheap anyway. Results are cached for the
+        APPROXIMATE_COUNT_TIMEOUT of the database.
+        """
+        connection = connections[using]
+        obj = self.clone()
+        obj.clear_ordering(True)
+        obj.select_for_update = False
+        obj.select_related = False
+        try:
+            sql, params = obj.get_compiler(using).as_sql()
+        except EmptyResultSet:
+            return 0
+        key = hashlib.sha1(repr((using, sql, tuple(params))).encode()).hexdigest()
+        cached = approximate_counts.get(key)
+        if cached is not None:
+            return cached[0][0]
+        unfiltered = not (
+            self.where or self.combinator or self.distinct or self.is_sliced or
+            self.group_by is not None or self.extra or len(self.alias_map) > 1
+        )
+        with connection.cursor() as cursor:
+            if unfiltered:
+                number = connection.ops.estimate_table_rows(cursor, self.get_meta().db_table)
+            else:
+                number = connection.ops.estimate_query_rows(cursor, sql, params)
+        if number is None or number < connection.settings_dict['APPROXIMATE_COUNT_THRESHOLD']:
+            number = self.get_count(using)
+        approximate_counts.set(key, ((number,),), connection.settings_dict['APPROXIMATE_COUNT_TIMEOUT'])
+        return number
+
     def has_filters(self):
         return self.where
 
@@ -9,7 +9,10 @@ from django.db.models.sql.constants import (
 )
 from django.db.models.sql.query import Query
 
-__all__ = ['DeleteQuery', 'UpdateQuery', 'InsertQuery', 'AggregateQuery']
+__all__ = [
+    'DeleteQuery', 'UpdateQuery', 'BulkUpdateQuery', 'InsertQuery',
+    'AggregateQuery',
+]
 
 
 class DeleteQuery(Query):
@@ -21,7 +24,12 @@ class DeleteQuery(Query):
         self.alias_map = {table: self.alias_map[table]}
         self.where = where
         cursor = self.get_compiler(using).execute_sql(CURSOR)
-        return cursor.rowcount if cursor else 0
+        if cursor is None:
+            return 0
+        try:
+            return cursor.rowcount
+        finally:
+            cursor.close()
 
     def delete_batch(self, pk_list, using):
         """
@@ -131,6 +139,33 @@ class UpdateQuery(Query):
         return result
 
 
+class BulkUpdateQuery(Query):
+    """
+    An UPDATE of several rows, each with its own values, joined against a
+    VALUES list on the primary key.
+    """
+
+    compiler = 'SQLBulkUpdateCompiler'
+
+    def __init__(self, *args, fields=(), **kwargs):
+        super().__init__(*args, **kwargs)
+        self.fields = list(fields)
+        self.objs = []
+        # The SQL only depends on the number of objects, so it's rendered
+        # once per batch size and reused for every batch of that size.
+        self.sql_cache = {}
+
+    def update_batch(self, objs, using):
+        self.objs = objs
+        cursor = self.get_compiler(using).execute_sql(CURSOR)
+        if cursor is None:
+            return 0
+        try:
+            return cursor.rowcount
+        finally:
+            cursor.close()
+
+
 class InsertQuery(Query):
     compiler = 'SQLInsertCompiler'
 
@@ -128,6 +128,30 @@ def on_commit(func, using=None):
     get_connection(using).on_commit(func)
 
 
+@contextmanager
+def batch_saves(using=None):
+    """
+    Within an atomic block, defer the UPDATE of Model.save() on instances
+    loaded from the database so that consecutive saves reach the database
+    together, right before the next other statement, the commit or the end
+    of the block, whichever comes first.
+
+    save() returns, and post_save is sent with created=False, before the
+    UPDATE runs. Its errors are raised later by whatever flushes it: an
+    unrelated query, the commit or the end of the block. If the row no
+    longer exists, DatabaseError is raised rather than inserting it as
+    save() does otherwise.
+    """
+    connection = get_connection(using)
+    connection.batching_saves += 1
+    try:
+        yield
+    finally:
+        connection.batching_saves -= 1
+    if connection.write_batch:
+        connection.write_batch.flush()
+
+
 #################################
 # Decorators / context managers #
 #################################
@@ -149,6 +173,11 @@ class Atomic(ContextDecorator):
     It's possible to disable the creation of savepoints if the goal is to
     ensure that some code runs within a transaction without creating overhead.
 
+    Savepoints are created lazily, right before the first statement that
+    needs one runs in the block. Blocks that don't run such statements don't
+    create their savepoint, there's then nothing to release or roll back on
+    exit.
+
     A stack of savepoints identifiers is maintained as an attribute of the
     connection. None denotes the absence of a savepoint.
 
@@ -185,7 +214,7 @@ class Atomic(ContextDecorator):
             # second condition avoids creating useless savepoints and prevents
             # overwriting needs_rollback until the rollback is performed.
             if self.savepoint and not connection.needs_rollback:
-                sid = connection.savepoint()
+                sid = connection.savepoint(lazy=True)
                 connection.savepoint_ids.append(sid)
             else:
                 connection.savepoint_ids.append(None)
@@ -196,8 +225,13 @@ class Atomic(ContextDecorator):
     def __exit__(self, exc_type, exc_value, traceback):
         connection = get_connection(self.using)
 
+        elided = False
         if connection.savepoint_ids:
             sid = connection.savepoint_ids.pop()
+            if sid is not None:
+                elided = connection.elide_savepoint(
+                    sid, rollback=exc_type is not None or connection.needs_rollback,
+                )
         else:
             # Prematurely unset this flag to allow using commit or rollback.
             connection.in_atomic_block = False
@@ -211,7 +245,7 @@ class Atomic(ContextDecorator):
             elif exc_type is None and not connection.needs_rollback:
                 if connection.in_atomic_block:
                     # Release savepoint if there is one
-                    if sid is not None:
+                    if sid is not None and not elided:
                         try:
                             connection.savepoint_commit(sid)
                         except DatabaseError:
@@ -247,7 +281,7 @@ class Atomic(ContextDecorator):
                     # otherwise.
                     if sid is None:
                         connection.needs_rollback = True
-                    else:
+                    elif not elided:
                         try:
                             connection.savepoint_rollback(sid)
                             # The savepoint won't be reused. Release it to
@@ -173,6 +173,8 @@ class ConnectionHandler:
         except KeyError:
             raise ConnectionDoesNotExist("The connection %s doesn't exist" % alias)
 
+        conn.setdefault('APPROXIMATE_COUNT_THRESHOLD', 10000)
+        conn.setdefault('APPROXIMATE_COUNT_TIMEOUT', 60)
         conn.setdefault('ATOMIC_REQUESTS', False)
         conn.setdefault('AUTOCOMMIT', True)
         conn.setdefault('ENGINE', 'django.db.backends.dummy')
@@ -1,5 +1,7 @@
 import functools
+import hashlib
 import re
+from collections import defaultdict
 from itertools import chain
 
 from django.conf import settings
@@ -12,9 +14,34 @@ from django.db.migrations.questioner import MigrationQuestioner
 from django.db.migrations.utils import (
     COMPILED_REGEX_TYPE, RegexObject, get_migration_name_timestamp,
 )
+from django.utils.functional import Promise
 from django.utils.topological_sort import stable_topological_sort
 
 
+def fingerprint_value(value):
+    """
+    Return a form of the deep_deconstruct() result value whose repr() is
+    equal for equal values: lazy translations become strings, dicts and
+    sets are sorted, and RegexObject, whose repr() is its id, is replaced.
+    """
+    if isinstance(value, Promise):
+        return str(value)
+    if isinstance(value, list):
+        return [fingerprint_value(item) for item in value]
+    if isinstance(value, tuple):
+        return tuple(fingerprint_value(item) for item in value)
+    if isinstance(value, dict):
+        return sorted(
+            ((key, fingerprint_value(item)) for key, item in value.items()),
+            key=repr,
+        )
+    if isinstance(value, (set, frozenset)):
+        return sorted((fingerprint_value(item) for item in value), key=repr)
+    if isinstance(value, RegexObject):
+        return ('RegexObject', value.pattern, value.flags)
+    return value
+
+
 class MigrationAutodetector:
     """
     Take a pair of ProjectStates and compare them to see what the first would
@@ -33,6 +60,11 @@ class MigrationAutodetector:
         self.to_state = to_state
         self.questioner = questioner or MigrationQuestioner()
         self.existing_apps = {app for app, model in from_state.models}
+        # Deconstructions of the fields of the model states and fingerprints
+        # of the model states, by id(). The objects are kept alongside so
+        # that their ids aren't reused.
+        self._field_deconstructions = {}
+        self._model_fingerprints = {}
 
     def changes(self, graph, trim_to_apps=None, convert_apps=None, migration_name=None):
         """
@@ -86,6 +118,47 @@ class MigrationAutodetector:
         else:
             return obj
 
+    def deconstruct_field(self, field):
+        """
+        Return deep_deconstruct(field), computed once per field. The result
+        is shared and must not be mutated.
+        """
+        try:
+            return self._field_deconstructions[id(field)][1]
+        except KeyError:
+            deconstruction = self.deep_deconstruct(field)
+            self._field_deconstructions[id(field)] = (field, deconstruction)
+            return deconstruction
+
+    def model_fingerprint(self, model_state):
+        """
+        Return a digest of everything the autodetector compares in a model
+        state. States with the same fingerprint have no changes between them.
+        """
+        try:
+            return self._model_fingerprints[id(model_state)][1]
+        except KeyError:
+            pass
+        options = [
+            (key, self.deep_deconstruct(value))
+            for key, value in sorted(model_state.options.items())
+        ]
+        content = repr(fingerprint_value((
+            model_state.app_label,
+            model_state.name,
+            [(name, self.deconstruct_field(field)) for name, field in model_state.fields],
+            options,
+            [base if isinstance(base, str) else (base.__module__, base.__qualname__) for base in model_state.bases],
+            # What Manager.__eq__() compares.
+            [
+                (name, type(manager).__module__, type(manager).__qualname__, manager._constructor_args)
+                for name, manager in model_state.managers
+            ],
+        )))
+        fingerprint = hashlib.sha1(content.encode()).digest()
+        self._model_fingerprints[id(model_state)] = (model_state, fingerprint)
+        return fingerprint
+
     def only_relation_agnostic_fields(self, fields):
         """
         Return a definition of the fields that ignores field names and
@@ -94,9 +167,10 @@ class MigrationAutodetector:
         """
         fields_def = []
         for name, field in sorted(fields):
-            deconstruction = self.deep_deconstruct(field)
+            deconstruction = self.deconstruct_field(field)
             if field.remote_field and field.remote_field.model:
-                del deconstruction[2]['to']
+                path, args, kwargs = deconstruction
+                deconstruction = (path, args, {key: value for key, value in kwargs.items() if key != 'to'})
             fields_def.append(deconstruction)
         return fields_def
 
@@ -206,6 +280,15 @@ class MigrationAutodetector:
         self.kept_model_keys = self.old_model_keys & self.new_model_keys
         self.kept_proxy_keys = self.old_proxy_keys & self.new_proxy_keys
         self.kept_unmanaged_keys = self.old_unmanaged_keys & self.new_unmanaged_keys
+        # Kept models whose state is identical in both states are skipped
+        # when looking for altered fields, indexes, constraints and options.
+        self.unchanged_model_keys = {
+            (app_label, model_name)
+            for app_label, model_name in chain(self.kept_model_keys, self.kept_proxy_keys, self.kept_unmanaged_keys)
+            if self.model_fingerprint(self.from_state.models[
+                app_label, self.renamed_models.get((app_label, model_name), model_name)
+            ]) == self.model_fingerprint(self.to_state.models[app_label, model_name])
+        }
         self.through_users = {}
         self.old_field_keys = {
             (app_label, model_name, x)
@@ -471,39 +554,53 @@ class MigrationAutodetector:
         self.renamed_models = {}
         self.renamed_models_rel = {}
         added_models = self.new_model_keys - self.old_model_keys
+        # Index the removed models by app and digest of their fields
+        # definition, candidates for a rename have the same.
+        removed_models = defaultdict(list)
+        for rem_app_label, rem_model_name in sorted(self.old_model_keys - self.new_model_keys):
+            rem_model_state = self.from_state.models[rem_app_label, rem_model_name]
+            rem_model_fields_def = self.only_relation_agnostic_fields(rem_model_state.fields)
+            removed_models[rem_app_label, self._fields_def_digest(rem_model_fields_def)].append(
+                (rem_model_name, rem_model_fields_def)
+            )
         for app_label, model_name in sorted(added_models):
             model_state = self.to_state.models[app_label, model_name]
             model_fields_def = self.only_relation_agnostic_fields(model_state.fields)
 
-            removed_models = self.old_model_keys - self.new_model_keys
-            for rem_app_label, rem_model_name in removed_models:
-                if rem_app_label == app_label:
-                    rem_model_state = self.from_state.models[rem_app_label, rem_model_name]
-                    rem_model_fields_def = self.only_relation_agnostic_fields(rem_model_state.fields)
-                    if model_fields_def == rem_model_fields_def:
-                        if self.questioner.ask_rename_model(rem_model_state, model_state):
-                            model_opts = self.new_apps.get_model(app_label, model_name)._meta
-                            dependencies = []
-                            for field in model_opts.get_fields():
-                                if field.is_relation:
-                                    dependencies.extend(self._get_dependencies_for_foreign_key(field))
-                            self.add_operation(
-                                app_label,
-                                operations.RenameModel(
-                                    old_name=rem_model_state.name,
-                                    new_name=model_state.name,
-                                ),
-                                dependencies=dependencies,
-                            )
-                            self.renamed_models[app_label, model_name] = rem_model_name
-                            renamed_models_rel_key = '%s.%s' % (rem_model_state.app_label, rem_model_state.name)
-                            self.renamed_models_rel[renamed_models_rel_key] = '%s.%s' % (
-                                model_state.app_label,
-                                model_state.name,
-                            )
-                            self.old_model_keys.remove((rem_app_label, rem_model_name))
-                            self.old_model_keys.add((app_label, model_name))
-                            break
+            candidates = removed_models[app_label, self._fields_def_digest(model_fields_def)]
+            for candidate in candidates:
+                rem_model_name, rem_model_fields_def = candidate
+                rem_app_label = app_label
+                rem_model_state = self.from_state.models[rem_app_label, rem_model_name]
+                if model_fields_def == rem_model_fields_def:
+                    if self.questioner.ask_rename_model(rem_model_state, model_state):
+                        model_opts = self.new_apps.get_model(app_label, model_name)._meta
+                        dependencies = []
+                        for field in model_opts.get_fields():
+                            if field.is_relation:
+                                dependencies.extend(self._get_dependencies_for_foreign_key(field))
+                        self.add_operation(
+                            app_label,
+                            operations.RenameModel(
+                                old_name=rem_model_state.name,
+                                new_name=model_state.name,
+                            ),
+                            dependencies=dependencies,
+                        )
+                        self.renamed_models[app_label, model_name] = rem_model_name
+                        renamed_models_rel_key = '%s.%s' % (rem_model_state.app_label, rem_model_state.name)
+                        self.renamed_models_rel[renamed_models_rel_key] = '%s.%s' % (
+                            model_state.app_label,
+                            model_state.name,
+                        )
+                        self.old_model_keys.remove((rem_app_label, rem_model_name))
+                        self.old_model_keys.add((app_label, model_name))
+                        candidates.remove(candidate)
+                        break
+
+    @staticmethod
+    def _fields_def_digest(fields_def):
+        return hashlib.sha1(repr(fields_def).encode()).digest()
 
     def generate_created_models(self):
         """
@@ -814,15 +911,17 @@ class MigrationAutodetector:
             old_model_state = self.from_state.models[app_label, old_model_name]
             field = self.new_apps.get_model(app_label, model_name)._meta.get_field(field_name)
             # Scan to see if this is actually a rename!
-            field_dec = self.deep_deconstruct(field)
+            field_dec = self.deconstruct_field(field)
             for rem_app_label, rem_model_name, rem_field_name in sorted(self.old_field_keys - self.new_field_keys):
                 if rem_app_label == app_label and rem_model_name == model_name:
                     old_field = old_model_state.get_field_by_name(rem_field_name)
-                    old_field_dec = self.deep_deconstruct(old_field)
+                    old_field_dec = self.deconstruct_field(old_field)
                     if field.remote_field and field.remote_field.model and 'to' in old_field_dec[2]:
                         old_rel_to = old_field_dec[2]['to']
                         if old_rel_to in self.renamed_models_rel:
-                            old_field_dec[2]['to'] = self.renamed_models_rel[old_rel_to]
+                            old_field_dec = old_field_dec[0:2] + (
+                                dict(old_field_dec[2], to=self.renamed_models_rel[old_rel_to]),
+                            )
                     old_field.set_attributes_from_name(rem_field_name)
                     old_db_column = old_field.get_attname_column()[1]
                     if (old_field_dec == field_dec or (
@@ -907,6 +1006,8 @@ class MigrationAutodetector:
         isn's possible.
         """
         for app_label, model_name, field_name in sorted(self.old_field_keys & self.new_field_keys):
+            if (app_label, model_name) in self.unchanged_model_keys:
+                continue
             # Did the field change?
             old_model_name = self.renamed_models.get((app_label, model_name), model_name)
             old_field_name = self.renamed_fields.get((app_label, model_name, field_name), field_name)
@@ -986,7 +1087,7 @@ class MigrationAutodetector:
 
     def create_altered_indexes(self):
         option_name = operations.AddIndex.option_name
-        for app_label, model_name in sorted(self.kept_model_keys):
+        for app_label, model_name in sorted(self.kept_model_keys - self.unchanged_model_keys):
             old_model_name = self.renamed_models.get((app_label, model_name), model_name)
             old_model_state = self.from_state.models[app_label, old_model_name]
             new_model_state = self.to_state.models[app_label, model_name]
@@ -1026,7 +1127,7 @@ class MigrationAutodetector:
 
     def create_altered_constraints(self):
         option_name = operations.AddConstraint.option_name
-        for app_label, model_name in sorted(self.kept_model_keys):
+        for app_label, model_name in sorted(self.kept_model_keys - self.unchanged_model_keys):
             old_model_name = self.renamed_models.get((app_label, model_name), model_name)
             old_model_state = self.from_state.models[app_label, old_model_name]
             new_model_state = self.to_state.models[app_label, model_name]
@@ -1085,7 +1186,7 @@ class MigrationAutodetector:
 
     def _generate_altered_foo_together(self, operation):
         option_name = operation.option_name
-        for app_label, model_name in sorted(self.kept_model_keys):
+        for app_label, model_name in sorted(self.kept_model_keys - self.unchanged_model_keys):
             old_model_name = self.renamed_models.get((app_label, model_name), model_name)
             old_model_state = self.from_state.models[app_label, old_model_name]
             new_model_state = self.to_state.models[app_label, model_name]
@@ -1207,7 +1308,7 @@ class MigrationAutodetector:
                 )
 
     def generate_altered_managers(self):
-        for app_label, model_name in sorted(self.kept_model_keys):
+        for app_label, model_name in sorted(self.kept_model_keys - self.unchanged_model_keys):
             old_model_name = self.renamed_models.get((app_label, model_name), model_name)
             old_model_state = self.from_state.models[app_label, old_model_name]
             new_model_state = self.to_state.models[app_label, model_name]
@@ -0,0 +1,169 @@
+import hashlib
+import os
+import pickle
+import tempfile
+from importlib import import_module
+
+from django.utils.version import get_version
+
+from .migration import Migration
+
+# Bump when the layout of the cache file changes.
+CACHE_FORMAT = 1
+
+
+class LazyMigration(Migration):
+    """
+    Stand-in for a migration restored from the cache. The dependency
+    information needed to build the graph is available right away; the
+    migration module is only imported when its operations are needed.
+    """
+    def __init__(self, name, app_label, module_name, dependencies, run_before, replaces):
+        self.name = name
+        self.app_label = app_label
+        self.module_name = module_name
+        self.dependencies = list(dependencies)
+        self.run_before = list(run_before)
+        self.replaces = list(replaces)
+        self._migration = None
+
+    @property
+    def migration(self):
+        if self._migration is None:
+            module = import_module(self.module_name)
+            self._migration = module.Migration(self.name, self.app_label)
+        return self._migration
+
+    @property
+    def operations(self):
+        return self.migration.operations
+
+    @property
+    def initial(self):
+        return self.migration.initial
+
+    @property
+    def atomic(self):
+        return self.migration.atomic
+
+    def mutate_state(self, project_state, preserve=True):
+        return self.migration.mutate_state(project_state, preserve=preserve)
+
+    def apply(self, project_state, schema_editor, collect_sql=False):
+        return self.migration.apply(project_state, schema_editor, collect_sql=collect_sql)
+
+    def unapply(self, project_state, schema_editor, collect_sql=False):
+        return self.migration.unapply(project_state, schema_editor, collect_sql=collect_sql)
+
+    def __getattr__(self, name):
+        # Attributes and methods of Migration subclasses.
+        if name.startswith('_'):
+            raise AttributeError(name)
+        return getattr(self.migration, name)
+
+
+class MigrationCache:
+    """
+    On-disk cache of the migrations found by MigrationLoader and of the
+    project state at the leaf nodes of the graph, stored in a pickle file.
+
+    The cache is keyed by a digest of the names and contents of every
+    migration file, so that adding, removing or editing one discards it.
+    """
+    def __init__(self, path, sources):
+        self.path = path
+        self.digest = self.make_digest(sources)
+        self.migrations = None
+        self.states = {}
+        self.load()
+
+    @staticmethod
+    def make_digest(sources):
+        """sources is a list of (migration module name, file path) pairs."""
+        digest = hashlib.sha1(('%s:%s' % (CACHE_FORMAT, get_version())).encode())
+        for module_name, path in sorted(sources):
+            digest.update(module_name.encode())
+            with open(path, 'rb') as fh:
+                digest.update(hashlib.sha1(fh.read()).digest())
+        return digest.hexdigest()
+
+    def load(self):
+        try:
+            with open(self.path, 'rb') as fh:
+                data = pickle.load(fh)
+        except Exception:
+            # Missing, unreadable or written by an incompatible version.
+            return
+        if not isinstance(data, dict) or data.get('digest') != self.digest:
+            return
+        self.migrations = data['migrations']
+        self.states = data['states']
+
+    def save(self):
+        data = {
+            'digest': self.digest,
+            'migrations': self.migrations,
+            'states': self.states,
+        }
+        try:
+            payload = pickle.dumps(data, pickle.HIGHEST_PROTOCOL)
+        except Exception:
+            # Some state can't be pickled (e.g. a lambda default), don't
+            # cache it.
+            data['states'] = self.states = {}
+            payload = pickle.dumps(data, pickle.HIGHEST_PROTOCOL)
+        directory = os.path.dirname(os.path.abspath(self.path))
+        os.makedirs(directory, exist_ok=True)
+        # Write atomically, processes may load the cache concurrently.
+        fd, tmp_path = tempfile.mkstemp(dir=directory, prefix='.migrations-')
+        try:
+            with os.fdopen(fd, 'wb') as fh:
+                fh.write(payload)
+            os.replace(tmp_path, self.path)
+        except OSError:
+            if os.path.exists(tmp_path):
+                os.remove(tmp_path)
+
+    def get_migrations(self):
+        """
+        Return {(app_label, name): LazyMigration} from the cache, or None if
+        it's stale.
+        """
+        if self.migrations is None:
+            return None
+        return {
+            (app_label, name): LazyMigration(name, app_label, *info)
+            for (app_label, name), info in self.migrations.items()
+        }
+
+    def set_migrations(self, modules, disk_migrations):
+        """
+        Remember the dependency information of disk_migrations. modules maps
+        their keys to the name of their module.
+        """
+        self.migrations = {
+            key: (
+                modules[key],
+                [tuple(dependency) for dependency in migration.dependencies],
+                [tuple(child) for child in migration.run_before],
+                [tuple(replaced) for replaced in migration.replaces],
+            )
+            for key, migration in disk_migrations.items()
+        }
+        self.states = {}
+        self.save()
+
+    @staticmethod
+    def state_key(nodes):
+        return hashlib.sha1(repr(sorted(nodes)).encode()).hexdigest()
+
+    def get_state_models(self, nodes):
+        """Return the models of the state after the given graph nodes."""
+        models = self.states.get(self.state_key(nodes))
+        if models is None:
+            return None
+        return {key: model_state.clone() for key, model_state in models.items()}
+
+    def set_state_models(self, nodes, models):
+        self.states[self.state_key(nodes)] = {key: model_state.clone() for key, model_state in models.items()}
+        self.save()
@@ -74,6 +74,10 @@ class MigrationExecutor:
                 self.loader.graph.nodes[key] for key in self.loader.applied_migrations
                 if key in self.loader.graph.nodes
             }
+            if all(migration in applied_migrations for migration, _ in full_plan):
+                # Nothing is left to apply, the state is the most recent one,
+                # which the loader may have cached.
+                return self.loader.project_state()
             for migration, _ in full_plan:
                 if migration in applied_migrations:
                     migration.mutate_state(state, preserve=False)
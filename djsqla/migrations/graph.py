@@ -84,14 +84,19 @@ class MigrationGraph:
     def __init__(self):
         self.node_map = {}
         self.nodes = {}
+        # Forwards and backwards plans by (node, forwards), until the graph
+        # changes.
+        self._plans = {}
 
     def add_node(self, key, migration):
         assert key not in self.node_map
+        self._plans.clear()
         node = Node(key)
         self.node_map[key] = node
         self.nodes[key] = migration
 
     def add_dummy_node(self, key, origin, error_message):
+        self._plans.clear()
         node = DummyNode(key, origin, error_message)
         self.node_map[key] = node
         self.nodes[key] = None
@@ -114,6 +119,7 @@ class MigrationGraph:
                 " parent node %r" % (migration, parent)
             )
             self.add_dummy_node(parent, migration, error_message)
+        self._plans.clear()
         self.node_map[child].add_parent(self.node_map[parent])
         self.node_map[parent].add_child(self.node_map[child])
         if not skip_validation:
@@ -135,6 +141,7 @@ class MigrationGraph:
                 " to the migration graph, or has been removed." % (replacement,),
                 replacement
             ) from err
+        self._plans.clear()
         for replaced_key in replaced:
             self.nodes.pop(replaced_key, None)
             replaced_node = self.node_map.pop(replaced_key, None)
@@ -161,6 +168,7 @@ class MigrationGraph:
         - the list of nodes it would have replaced. Don't remap its parent
         nodes as they are expected to be correct already.
         """
+        self._plans.clear()
         self.nodes.pop(replacement, None)
         try:
             replacement_node = self.node_map.pop(replacement)
@@ -202,7 +210,7 @@ class MigrationGraph:
         """
         if target not in self.nodes:
             raise NodeNotFoundError("Node %r not a valid node" % (target,), target)
-        return self.iterative_dfs(self.node_map[target])
+        return list(self._get_plan(target, True))
 
     def backwards_plan(self, target):
         """
@@ -212,7 +220,13 @@ class MigrationGraph:
         """
         if target not in self.nodes:
             raise NodeNotFoundError("Node %r not a valid node" % (target,), target)
-        return self.iterative_dfs(self.node_map[target], forwards=False)
+        return list(self._get_plan(target, False))
+
+    def _get_plan(self, target, forwards):
+        plan = self._plans.get((target, forwards))
+        if plan is None:
+            plan = self._plans[target, forwards] = self.iterative_dfs(self.node_map[target], forwards)
+        return plan
 
     def iterative_dfs(self, start, forwards=True):
         """Iterative depth-first search for finding dependencies."""
@@ -291,9 +305,14 @@ class MigrationGraph:
 
     def _generate_plan(self, nodes, at_end):
         plan = []
+        # Migrations already in the plan or excluded from it.
+        seen = set() if at_end else set(nodes)
         for node in nodes:
-            for migration in self.forwards_plan(node):
-                if migration not in plan and (at_end or migration not in nodes):
+            if node not in self.nodes:
+                raise NodeNotFoundError("Node %r not a valid node" % (node,), node)
+            for migration in self._get_plan(node, True):
+                if migration not in seen:
+                    seen.add(migration)
                     plan.append(migration)
         return plan
 
@@ -1,11 +1,14 @@
 import pkgutil
 import sys
 from importlib import import_module, reload
+from importlib.util import find_spec
 
 from django.apps import apps
 from django.conf import settings
+from django.db.migrations.cache import MigrationCache
 from django.db.migrations.graph import MigrationGraph
 from django.db.migrations.recorder import MigrationRecorder
+from django.db.migrations.state import ProjectState
 
 from .exceptions import (
     AmbiguityError, BadMigrationError, InconsistentMigrationHistory,
@@ -38,6 +41,11 @@ class MigrationLoader:
     This does mean that this class MUST also talk to the database as well as
     to disk, but this is probably fine. We're already not just operating
     in memory.
+
+    If settings.MIGRATION_CACHE_FILE is set, the dependencies of the
+    migrations and the project state they lead to are cached in that file
+    until a migration file changes. Migration modules are then only imported
+    when they must be applied or unapplied.
     """
 
     def __init__(self, connection, load=True, ignore_no_migrations=False):
@@ -45,6 +53,7 @@ class MigrationLoader:
         self.disk_migrations = None
         self.applied_migrations = None
         self.ignore_no_migrations = ignore_no_migrations
+        self.cache = None
         if load:
             self.build_graph()
 
@@ -66,6 +75,8 @@ class MigrationLoader:
         self.disk_migrations = {}
         self.unmigrated_apps = set()
         self.migrated_apps = set()
+        # Module names of the migrations.
+        modules = {}
         for app_config in apps.get_app_configs():
             # Get the migrations module directory
             module_name, explicit = self.migrations_module(app_config.label)
@@ -99,27 +110,52 @@ class MigrationLoader:
                 self.migrated_apps.add(app_config.label)
             else:
                 self.unmigrated_apps.add(app_config.label)
-            # Load migrations
             for migration_name in migration_names:
-                migration_path = '%s.%s' % (module_name, migration_name)
-                try:
-                    migration_module = import_module(migration_path)
-                except ImportError as e:
-                    if 'bad magic number' in str(e):
-                        raise ImportError(
-                            "Couldn't import %r as it appears to be a stale "
-                            ".pyc file." % migration_path
-                        ) from e
-                    else:
-                        raise
-                if not hasattr(migration_module, "Migration"):
-                    raise BadMigrationError(
-                        "Migration %s in app %s has no Migration class" % (migration_name, app_config.label)
-                    )
-                self.disk_migrations[app_config.label, migration_name] = migration_module.Migration(
-                    migration_name,
-                    app_config.label,
+                modules[app_config.label, migration_name] = '%s.%s' % (module_name, migration_name)
+        self.cache = self.get_cache(modules)
+        if self.cache is not None:
+            cached_migrations = self.cache.get_migrations()
+            if cached_migrations is not None:
+                self.disk_migrations = cached_migrations
+                return
+        # Load migrations
+        for (app_label, migration_name), migration_path in modules.items():
+            try:
+                migration_module = import_module(migration_path)
+            except ImportError as e:
+                if 'bad magic number' in str(e):
+                    raise ImportError(
+                        "Couldn't import %r as it appears to be a stale "
+                        ".pyc file." % migration_path
+                    ) from e
+                else:
+                    raise
+            if not hasattr(migration_module, "Migration"):
+                raise BadMigrationError(
+                    "Migration %s in app %s has no Migration class" % (migration_name, app_label)
                 )
+            self.disk_migrations[app_label, migration_name] = migration_module.Migration(
+                migration_name,
+                app_label,
+            )
+        if self.cache is not None:
+            self.cache.set_migrations(modules, self.disk_migrations)
+
+    def get_cache(self, modules):
+        """
+        Return the MigrationCache for the given migration modules, or None if
+        caching is disabled or a migration isn't a Python source file.
+        """
+        path = getattr(settings, 'MIGRATION_CACHE_FILE', None)
+        if not path:
+            return None
+        sources = []
+        for migration_path in modules.values():
+            spec = find_spec(migration_path)
+            if spec is None or not spec.has_location or not spec.origin.endswith('.py'):
+                return None
+            sources.append((migration_path, spec.origin))
+        return MigrationCache(path, sources)
 
     def get_migration(self, app_label, name_prefix):
         """Return the named migration or raise NodeNotFoundError."""
@@ -319,4 +355,12 @@ class MigrationLoader:
 
         See graph.make_state() for the meaning of "nodes" and "at_end".
         """
+        if nodes is None and at_end and self.cache is not None:
+            # The most recent state is cached for the current set of nodes.
+            models = self.cache.get_state_models(self.graph.nodes)
+            if models is not None:
+                return ProjectState(models=models, real_apps=list(self.unmigrated_apps))
+            state = self.graph.make_state(real_apps=list(self.unmigrated_apps))
+            self.cache.set_state_models(self.graph.nodes, state.models)
+            return state
         return self.graph.make_state(nodes=nodes, at_end=at_end, real_apps=list(self.unmigrated_apps))
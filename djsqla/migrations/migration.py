@@ -96,32 +96,36 @@ class Migration:
         Return the resulting project state for efficient reuse by following
         Migrations.
         """
-        for operation in self.operations:
-            # If this operation cannot be represented as SQL, place a comment
-            # there instead
-            if collect_sql:
-                schema_editor.collected_sql.append("--")
-                if not operation.reduces_to_sql:
-                    schema_editor.collected_sql.append(
-                        "-- MIGRATION NOW PERFORMS OPERATION THAT CANNOT BE WRITTEN AS SQL:"
-                    )
-                schema_editor.collected_sql.append("-- %s" % operation.describe())
-                schema_editor.collected_sql.append("--")
+        with schema_editor.batch_alter():
+            for operation in self.operations:
+                # If this operation cannot be represented as SQL, place a comment
+                # there instead
+                if collect_sql:
+                    schema_editor.collected_sql.append("--")
+                    if not operation.reduces_to_sql:
+                        schema_editor.collected_sql.append(
+                            "-- MIGRATION NOW PERFORMS OPERATION THAT CANNOT BE WRITTEN AS SQL:"
+                        )
+                    schema_editor.collected_sql.append("-- %s" % operation.describe())
+                    schema_editor.collected_sql.append("--")
+                    if not operation.reduces_to_sql:
+                        continue
                 if not operation.reduces_to_sql:
-                    continue
-            # Save the state before the operation has run
-            old_state = project_state.clone()
-            operation.state_forwards(self.app_label, project_state)
-            # Run the operation
-            atomic_operation = operation.atomic or (self.atomic and operation.atomic is not False)
-            if not schema_editor.atomic_migration and atomic_operation:
-                # Force a transaction on a non-transactional-DDL backend or an
-                # atomic operation inside a non-atomic migration.
-                with atomic(schema_editor.connection.alias):
+                    # Python code sees the tables as altered so far.
+                    schema_editor.flush_batch()
+                # Save the state before the operation has run
+                old_state = project_state.clone()
+                operation.state_forwards(self.app_label, project_state)
+                # Run the operation
+                atomic_operation = operation.atomic or (self.atomic and operation.atomic is not False)
+                if not schema_editor.atomic_migration and atomic_operation:
+                    # Force a transaction on a non-transactional-DDL backend or an
+                    # atomic operation inside a non-atomic migration.
+                    with atomic(schema_editor.connection.alias):
+                        operation.database_forwards(self.app_label, schema_editor, old_state, project_state)
+                else:
+                    # Normal behaviour
                     operation.database_forwards(self.app_label, schema_editor, old_state, project_state)
-            else:
-                # Normal behaviour
-                operation.database_forwards(self.app_label, schema_editor, old_state, project_state)
         return project_state
 
     def unapply(self, project_state, schema_editor, collect_sql=False):
@@ -153,26 +157,30 @@ class Migration:
             to_run.insert(0, (operation, old_state, new_state))
 
         # Phase 2
-        for operation, to_state, from_state in to_run:
-            if collect_sql:
-                schema_editor.collected_sql.append("--")
-                if not operation.reduces_to_sql:
-                    schema_editor.collected_sql.append(
-                        "-- MIGRATION NOW PERFORMS OPERATION THAT CANNOT BE WRITTEN AS SQL:"
-                    )
-                schema_editor.collected_sql.append("-- %s" % operation.describe())
-                schema_editor.collected_sql.append("--")
+        with schema_editor.batch_alter():
+            for operation, to_state, from_state in to_run:
+                if collect_sql:
+                    schema_editor.collected_sql.append("--")
+                    if not operation.reduces_to_sql:
+                        schema_editor.collected_sql.append(
+                            "-- MIGRATION NOW PERFORMS OPERATION THAT CANNOT BE WRITTEN AS SQL:"
+                        )
+                    schema_editor.collected_sql.append("-- %s" % operation.describe())
+                    schema_editor.collected_sql.append("--")
+                    if not operation.reduces_to_sql:
+                        continue
                 if not operation.reduces_to_sql:
-                    continue
-            atomic_operation = operation.atomic or (self.atomic and operation.atomic is not False)
-            if not schema_editor.atomic_migration and atomic_operation:
-                # Force a transaction on a non-transactional-DDL backend or an
-                # atomic operation inside a non-atomic migration.
-                with atomic(schema_editor.connection.alias):
+                    # Python code sees the tables as altered so far.
+                    schema_editor.flush_batch()
+                atomic_operation = operation.atomic or (self.atomic and operation.atomic is not False)
+                if not schema_editor.atomic_migration and atomic_operation:
+                    # Force a transaction on a non-transactional-DDL backend or an
+                    # atomic operation inside a non-atomic migration.
+                    with atomic(schema_editor.connection.alias):
+                        operation.database_backwards(self.app_label, schema_editor, from_state, to_state)
+                else:
+                    # Normal behaviour
                     operation.database_backwards(self.app_label, schema_editor, from_state, to_state)
-            else:
-                # Normal behaviour
-                operation.database_backwards(self.app_label, schema_editor, from_state, to_state)
         return project_state
 
 
@@ -76,6 +76,29 @@ def get_related_models_recursive(model):
     return seen - {(model._meta.app_label, model._meta.model_name)}
 
 
+def get_model_state_references(model_state):
+    """
+    Return the (app_label, model_name) tuples of the models that the given
+    ModelState refers to through its bases and relational fields.
+    """
+    app_label = model_state.app_label
+    references = set()
+    for base in model_state.bases:
+        if isinstance(base, str):
+            base_app_label, base_name = _get_app_label_and_model_name(base, app_label)
+            references.add((base_app_label, base_name.lower()))
+    for name, field in model_state.fields:
+        if not field.is_relation or field.remote_field is None:
+            continue
+        for target in (field.remote_field.model, getattr(field.remote_field, 'through', None)):
+            if target is None or target == RECURSIVE_RELATIONSHIP_CONSTANT:
+                continue
+            rel_app_label, rel_model_name = _get_app_label_and_model_name(target, app_label)
+            references.add((rel_app_label, rel_model_name.lower()))
+    references.discard((app_label, model_state.name_lower))
+    return frozenset(references)
+
+
 class ProjectState:
     """
     Represent the entire project's overall state. This is the item that is
@@ -88,6 +111,10 @@ class ProjectState:
         # Apps to include from main registry, usually unmigrated ones
         self.real_apps = real_apps or []
         self.is_delayed = False
+        # Models referenced by each model and models referencing each model,
+        # maintained while the apps are rendered.
+        self._references = None
+        self._referenced_by = None
 
     def add_model(self, model_state):
         app_label, model_name = model_state.app_label, model_state.name_lower
@@ -98,57 +125,58 @@ class ProjectState:
     def remove_model(self, app_label, model_name):
         del self.models[app_label, model_name]
         if 'apps' in self.__dict__:  # hasattr would cache the property
+            if self._references is not None:
+                self._set_references((app_label, model_name), frozenset())
             self.apps.unregister_model(app_label, model_name)
             # Need to do this explicitly since unregister_model() doesn't clear
             # the cache automatically (#24513)
             self.apps.clear_cache()
 
+    def _set_references(self, key, references):
+        """Record that the model key refers to the models in references."""
+        old_references = self._references.get(key, frozenset())
+        for target in old_references - references:
+            self._referenced_by[target] = self._referenced_by[target] - {key}
+        for target in references - old_references:
+            self._referenced_by[target] = self._referenced_by.get(target, frozenset()) | {key}
+        if references:
+            self._references[key] = references
+        else:
+            self._references.pop(key, None)
+
+    def _build_references(self):
+        self._references = {}
+        self._referenced_by = {}
+        for model_state in [*self.apps.real_models, *self.models.values()]:
+            self._set_references(
+                (model_state.app_label, model_state.name_lower),
+                get_model_state_references(model_state),
+            )
+
     def _find_reload_model(self, app_label, model_name, delay=False):
         if delay:
             self.is_delayed = True
 
-        related_models = set()
-
-        try:
-            old_model = self.apps.get_model(app_label, model_name)
-        except LookupError:
-            pass
-        else:
-            # Get all relations to and from the old model before reloading,
-            # as _meta.apps may change
-            if delay:
-                related_models = get_related_models_tuples(old_model)
-            else:
-                related_models = get_related_models_recursive(old_model)
-
-        # Get all outgoing references from the model to be rendered
-        model_state = self.models[(app_label, model_name)]
-        # Directly related models are the models pointed to by ForeignKeys,
-        # OneToOneFields, and ManyToManyFields.
-        direct_related_models = set()
-        for name, field in model_state.fields:
-            if field.is_relation:
-                if field.remote_field.model == RECURSIVE_RELATIONSHIP_CONSTANT:
-                    continue
-                rel_app_label, rel_model_name = _get_app_label_and_model_name(field.related_model, app_label)
-                direct_related_models.add((rel_app_label, rel_model_name.lower()))
-
-        # For all direct related models recursively get all related models.
-        related_models.update(direct_related_models)
-        for rel_app_label, rel_model_name in direct_related_models:
-            try:
-                rel_model = self.apps.get_model(rel_app_label, rel_model_name)
-            except LookupError:
-                pass
-            else:
-                if delay:
-                    related_models.update(get_related_models_tuples(rel_model))
-                else:
-                    related_models.update(get_related_models_recursive(rel_model))
-
-        # Include the model itself
-        related_models.add((app_label, model_name))
-
+        if self._references is None:
+            self._build_references()
+        key = (app_label, model_name)
+        old_references = self._references.get(key, frozenset())
+        model_state = self.models[key]
+        self._set_references(key, get_model_state_references(model_state))
+
+        # The models the old and new classes refer to (by a relation or as a
+        # base) are rendered again, so that no reverse descriptor pointing to
+        # the class being replaced is left behind. Then the models whose
+        # classes refer to any of these must be, and so on. When delayed,
+        # only the direct referrers are.
+        related_models = {key} | old_references | self._references.get(key, frozenset())
+        queue = list(related_models)
+        while queue:
+            for referrer in self._referenced_by.get(queue.pop(), ()):
+                if referrer not in related_models:
+                    related_models.add(referrer)
+                    if not delay:
+                        queue.append(referrer)
         return related_models
 
     def reload_model(self, app_label, model_name, delay=False):
@@ -197,12 +225,17 @@ class ProjectState:
         )
         if 'apps' in self.__dict__:
             new_state.apps = self.apps.clone()
+            if self._references is not None:
+                # Values are frozensets, shallow copies are enough.
+                new_state._references = dict(self._references)
+                new_state._referenced_by = dict(self._referenced_by)
         new_state.is_delayed = self.is_delayed
         return new_state
 
     def clear_delayed_apps_cache(self):
         if self.is_delayed and 'apps' in self.__dict__:
             del self.__dict__['apps']
+            self._references = self._referenced_by = None
 
     @cached_property
     def apps(self):
@@ -211,6 +244,7 @@ class ProjectState:
     @property
     def concrete_apps(self):
         self.apps = StateApps(self.real_apps, self.models, ignore_swappable=True)
+        self._references = self._referenced_by = None
         return self.apps
 
     @classmethod
@@ -291,30 +325,62 @@ class StateApps(Apps):
             self.clear_cache()
 
     def render_multiple(self, model_states):
-        # We keep trying to render the models in a loop, ignoring invalid
-        # base errors, until the size of the unrendered models doesn't
-        # decrease by at least one, meaning there's a base dependency loop/
-        # missing base.
+        # Render the models in a single pass, bases first. Models whose bases
+        # can't be resolved then are either missing a base or part of a base
+        # dependency loop.
         if not model_states:
             return
         # Prevent that all model caches are expired for each render.
         with self.bulk_update():
-            unrendered_models = model_states
-            while unrendered_models:
-                new_unrendered_models = []
-                for model in unrendered_models:
-                    try:
-                        model.render(self)
-                    except InvalidBasesError:
-                        new_unrendered_models.append(model)
-                if len(new_unrendered_models) == len(unrendered_models):
-                    raise InvalidBasesError(
-                        "Cannot resolve bases for %r\nThis can happen if you are inheriting models from an "
-                        "app with migrations (e.g. contrib.auth)\n in an app with no migrations; see "
-                        "https://docs.djangoproject.com/en/%s/topics/migrations/#dependencies "
-                        "for more" % (new_unrendered_models, get_docs_version())
-                    )
-                unrendered_models = new_unrendered_models
+            unrendered_models = []
+            for model in self._order_by_bases(model_states):
+                try:
+                    model.render(self)
+                except InvalidBasesError:
+                    unrendered_models.append(model)
+            if unrendered_models:
+                raise InvalidBasesError(
+                    "Cannot resolve bases for %r\nThis can happen if you are inheriting models from an "
+                    "app with migrations (e.g. contrib.auth)\n in an app with no migrations; see "
+                    "https://docs.djangoproject.com/en/%s/topics/migrations/#dependencies "
+                    "for more" % (unrendered_models, get_docs_version())
+                )
+
+    @staticmethod
+    def _order_by_bases(model_states):
+        """
+        Return model_states ordered so that each model comes after the
+        models of model_states it inherits from, keeping the given order
+        otherwise.
+        """
+        by_key = {(model.app_label, model.name_lower): model for model in model_states}
+        ordered = []
+        # ids of the ordered models and of the models being ordered.
+        done = set()
+        in_stack = set()
+        for model in model_states:
+            stack = [model]
+            in_stack.add(id(model))
+            while stack:
+                current = stack[-1]
+                for base in current.bases:
+                    if not isinstance(base, str):
+                        continue
+                    base_app_label, base_name = _get_app_label_and_model_name(base, current.app_label)
+                    base_model = by_key.get((base_app_label, base_name.lower()))
+                    # Other bases must already be rendered, loops are
+                    # reported by render_multiple().
+                    if base_model is not None and id(base_model) not in done and id(base_model) not in in_stack:
+                        stack.append(base_model)
+                        in_stack.add(id(base_model))
+                        break
+                else:
+                    stack.pop()
+                    in_stack.discard(id(current))
+                    if id(current) not in done:
+                        done.add(id(current))
+                        ordered.append(current)
+        return ordered
 
     def clone(self):
         """Return a clone of this registry."""
@@ -0,0 +1,745 @@
+/*
+pgcopy.c
+
+This module is part of SQLAlchemy and is released under
+the MIT License: http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include <Python.h>
+#include <datetime.h>
+#include <string.h>
+
+#define MODULE_NAME "cpgcopy"
+#define MODULE_DOC "Module containing a C encoder for PostgreSQL binary COPY data."
+
+/* Type codes, these must match the ones in binarycopy.py */
+enum {
+    PGCOPY_BOOL, PGCOPY_INT2, PGCOPY_INT4, PGCOPY_INT8, PGCOPY_FLOAT4,
+    PGCOPY_FLOAT8, PGCOPY_TEXT, PGCOPY_BYTEA, PGCOPY_DATE, PGCOPY_TIME,
+    PGCOPY_TIMESTAMP, PGCOPY_INTERVAL, PGCOPY_NUMERIC, PGCOPY_UUID,
+    PGCOPY_TIMESTAMP_NAIVE, PGCOPY_NUM_TYPES
+};
+
+#define NUMERIC_POS 0x0000
+#define NUMERIC_NEG 0x4000
+#define NUMERIC_NAN 0xC000
+
+/* Days from 0001-01-01 to 2000-01-01, the PostgreSQL epoch */
+#define POSTGRES_EPOCH_ORDINAL 730120
+
+#if PY_VERSION_HEX < 0x030B0000
+#define PyFloat_Pack4 _PyFloat_Pack4
+#define PyFloat_Pack8 _PyFloat_Pack8
+#endif
+
+#define USECS_PER_SEC 1000000LL
+#define USECS_PER_DAY (86400LL * USECS_PER_SEC)
+
+static PyObject *decimal_type = NULL;
+
+/**********
+ * Buffer *
+ **********/
+
+typedef struct {
+    char *data;
+    Py_ssize_t size;
+    Py_ssize_t allocated;
+} Buffer;
+
+static int
+Buffer_reserve(Buffer *buf, Py_ssize_t extra)
+{
+    Py_ssize_t needed = buf->size + extra;
+    Py_ssize_t allocated;
+    char *data;
+
+    if (needed <= buf->allocated)
+        return 0;
+    allocated = buf->allocated ? buf->allocated : 4096;
+    while (allocated < needed)
+        allocated *= 2;
+    data = PyMem_Realloc(buf->data, allocated);
+    if (data == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    buf->data = data;
+    buf->allocated = allocated;
+    return 0;
+}
+
+static int
+Buffer_put_bytes(Buffer *buf, const char *bytes, Py_ssize_t length)
+{
+    if (Buffer_reserve(buf, length) < 0)
+        return -1;
+    memcpy(buf->data + buf->size, bytes, length);
+    buf->size += length;
+    return 0;
+}
+
+static int
+Buffer_put_uint16(Buffer *buf, unsigned int value)
+{
+    unsigned char bytes[2];
+
+    bytes[0] = (value >> 8) & 0xff;
+    bytes[1] = value & 0xff;
+    return Buffer_put_bytes(buf, (const char *)bytes, 2);
+}
+
+static int
+Buffer_put_int32(Buffer *buf, long value)
+{
+    unsigned char bytes[4];
+    unsigned long v = (unsigned long)value;
+
+    bytes[0] = (v >> 24) & 0xff;
+    bytes[1] = (v >> 16) & 0xff;
+    bytes[2] = (v >> 8) & 0xff;
+    bytes[3] = v & 0xff;
+    return Buffer_put_bytes(buf, (const char *)bytes, 4);
+}
+
+static int
+Buffer_put_int64(Buffer *buf, PY_LONG_LONG value)
+{
+    unsigned char bytes[8];
+    unsigned PY_LONG_LONG v = (unsigned PY_LONG_LONG)value;
+    int i;
+
+    for (i = 7; i >= 0; i--) {
+        bytes[i] = v & 0xff;
+        v >>= 8;
+    }
+    return Buffer_put_bytes(buf, (const char *)bytes, 8);
+}
+
+/************
+ * Encoders *
+ ************/
+
+/* Each encoder appends the int32 length followed by the value. */
+
+static int
+encode_integer(Buffer *buf, PyObject *value, int size)
+{
+    PY_LONG_LONG v;
+
+    v = PyLong_AsLongLong(value);
+    if (v == -1 && PyErr_Occurred())
+        return -1;
+    if ((size == 2 && (v < -32768 || v > 32767)) ||
+        (size == 4 && (v < -2147483647LL - 1 || v > 2147483647LL))) {
+        PyErr_Format(PyExc_OverflowError,
+            "value %lld out of range for a %d-byte integer", v, size);
+        return -1;
+    }
+    if (Buffer_put_int32(buf, size) < 0)
+        return -1;
+    if (size == 2)
+        return Buffer_put_uint16(buf, (unsigned int)(v & 0xffff));
+    if (size == 4)
+        return Buffer_put_int32(buf, (long)v);
+    return Buffer_put_int64(buf, v);
+}
+
+static int
+encode_float(Buffer *buf, PyObject *value, int size)
+{
+    double d;
+    unsigned char bytes[8];
+
+    d = PyFloat_AsDouble(value);
+    if (d == -1.0 && PyErr_Occurred())
+        return -1;
+    if (Buffer_put_int32(buf, size) < 0)
+        return -1;
+    if (size == 4) {
+        if (PyFloat_Pack4(d, (char *)bytes, 0) < 0)
+            return -1;
+    } else {
+        if (PyFloat_Pack8(d, (char *)bytes, 0) < 0)
+            return -1;
+    }
+    return Buffer_put_bytes(buf, (const char *)bytes, size);
+}
+
+static int
+encode_text(Buffer *buf, PyObject *value)
+{
+    PyObject *str;
+    const char *data;
+    Py_ssize_t length;
+    int result;
+
+    if (PyUnicode_Check(value)) {
+        Py_INCREF(value);
+        str = value;
+    } else {
+        str = PyObject_Str(value);
+        if (str == NULL)
+            return -1;
+    }
+    data = PyUnicode_AsUTF8AndSize(str, &length);
+    if (data == NULL) {
+        Py_DECREF(str);
+        return -1;
+    }
+    result = Buffer_put_int32(buf, (long)length);
+    if (result == 0)
+        result = Buffer_put_bytes(buf, data, length);
+    Py_DECREF(str);
+    return result;
+}
+
+static int
+encode_bytea(Buffer *buf, PyObject *value)
+{
+    Py_buffer view;
+    int result;
+
+    if (PyObject_GetBuffer(value, &view, PyBUF_SIMPLE) < 0)
+        return -1;
+    result = Buffer_put_int32(buf, (long)view.len);
+    if (result == 0)
+        result = Buffer_put_bytes(buf, view.buf, view.len);
+    PyBuffer_Release(&view);
+    return result;
+}
+
+/* Days since 0001-01-01 for a proleptic Gregorian date, date.toordinal() - 1 */
+static long
+days_from_civil(int year, int month, int day)
+{
+    static const int days_before_month[] = {
+        0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+    };
+    long y = year - 1;
+    long days = y * 365 + y / 4 - y / 100 + y / 400;
+    int leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+
+    days += days_before_month[month] + (month > 2 && leap) + day - 1;
+    return days;
+}
+
+static int
+encode_date(Buffer *buf, PyObject *value)
+{
+    long days;
+
+    if (!PyDate_Check(value)) {
+        PyErr_Format(PyExc_TypeError, "expected a date, got %R", value);
+        return -1;
+    }
+    days = days_from_civil(PyDateTime_GET_YEAR(value),
+                           PyDateTime_GET_MONTH(value),
+                           PyDateTime_GET_DAY(value));
+    if (Buffer_put_int32(buf, 4) < 0)
+        return -1;
+    return Buffer_put_int32(buf, days + 1 - POSTGRES_EPOCH_ORDINAL);
+}
+
+static int
+encode_time(Buffer *buf, PyObject *value)
+{
+    PY_LONG_LONG usecs;
+
+    if (!PyTime_Check(value)) {
+        PyErr_Format(PyExc_TypeError, "expected a time, got %R", value);
+        return -1;
+    }
+    usecs = ((PyDateTime_TIME_GET_HOUR(value) * 60LL +
+              PyDateTime_TIME_GET_MINUTE(value)) * 60LL +
+             PyDateTime_TIME_GET_SECOND(value)) * USECS_PER_SEC +
+            PyDateTime_TIME_GET_MICROSECOND(value);
+    if (Buffer_put_int32(buf, 8) < 0)
+        return -1;
+    return Buffer_put_int64(buf, usecs);
+}
+
+static PY_LONG_LONG
+timedelta_usecs(PyObject *delta)
+{
+    return PyDateTime_DELTA_GET_DAYS(delta) * USECS_PER_DAY +
+           PyDateTime_DELTA_GET_SECONDS(delta) * USECS_PER_SEC +
+           PyDateTime_DELTA_GET_MICROSECONDS(delta);
+}
+
+static int
+encode_timestamp(Buffer *buf, PyObject *value, int to_utc)
+{
+    PyObject *offset;
+    PY_LONG_LONG usecs;
+
+    if (!PyDateTime_Check(value)) {
+        PyErr_Format(PyExc_TypeError, "expected a datetime, got %R", value);
+        return -1;
+    }
+    usecs = (days_from_civil(PyDateTime_GET_YEAR(value),
+                             PyDateTime_GET_MONTH(value),
+                             PyDateTime_GET_DAY(value)) + 1 -
+             POSTGRES_EPOCH_ORDINAL) * USECS_PER_DAY +
+            ((PyDateTime_DATE_GET_HOUR(value) * 60LL +
+              PyDateTime_DATE_GET_MINUTE(value)) * 60LL +
+             PyDateTime_DATE_GET_SECOND(value)) * USECS_PER_SEC +
+            PyDateTime_DATE_GET_MICROSECOND(value);
+
+    /* aware values are sent as UTC to timestamp with time zone columns,
+       and as their wall-clock time to timestamp columns */
+    if (!to_utc)
+        goto done;
+    offset = PyObject_CallMethod(value, "utcoffset", NULL);
+    if (offset == NULL)
+        return -1;
+    if (offset != Py_None) {
+        if (!PyDelta_Check(offset)) {
+            Py_DECREF(offset);
+            PyErr_SetString(PyExc_TypeError,
+                            "utcoffset() must return a timedelta");
+            return -1;
+        }
+        usecs -= timedelta_usecs(offset);
+    }
+    Py_DECREF(offset);
+
+done:
+    if (Buffer_put_int32(buf, 8) < 0)
+        return -1;
+    return Buffer_put_int64(buf, usecs);
+}
+
+static int
+encode_interval(Buffer *buf, PyObject *value)
+{
+    if (!PyDelta_Check(value)) {
+        PyErr_Format(PyExc_TypeError, "expected a timedelta, got %R", value);
+        return -1;
+    }
+    /* microseconds, days and months */
+    if (Buffer_put_int32(buf, 16) < 0 ||
+        Buffer_put_int64(buf, timedelta_usecs(value)) < 0 ||
+        Buffer_put_int32(buf, 0) < 0)
+        return -1;
+    return Buffer_put_int32(buf, 0);
+}
+
+static int
+encode_numeric(Buffer *buf, PyObject *value)
+{
+    PyObject *dec, *as_tuple = NULL, *digits_tuple, *exponent_obj, *is_nan;
+    long sign, exponent, dscale, integer_length, fraction_length;
+    long weight, num_digits, num_padded, left_pad, i, start, end;
+    unsigned char *digits = NULL;
+    unsigned int *groups = NULL;
+    long num_groups;
+    int result = -1;
+
+    if (PyObject_IsInstance(value, decimal_type) == 1) {
+        Py_INCREF(value);
+        dec = value;
+    } else {
+        dec = PyObject_CallFunctionObjArgs(decimal_type, value, NULL);
+        if (dec == NULL)
+            return -1;
+    }
+
+    as_tuple = PyObject_CallMethod(dec, "as_tuple", NULL);
+    if (as_tuple == NULL)
+        goto done;
+    sign = PyLong_AsLong(PyTuple_GET_ITEM(as_tuple, 0));
+    digits_tuple = PyTuple_GET_ITEM(as_tuple, 1);
+    exponent_obj = PyTuple_GET_ITEM(as_tuple, 2);
+
+    if (!PyLong_Check(exponent_obj)) {
+        is_nan = PyObject_CallMethod(dec, "is_nan", NULL);
+        if (is_nan == NULL)
+            goto done;
+        if (is_nan == Py_True) {
+            Py_DECREF(is_nan);
+            if (Buffer_put_int32(buf, 8) < 0 || Buffer_put_uint16(buf, 0) < 0 ||
+                Buffer_put_uint16(buf, 0) < 0 ||
+                Buffer_put_uint16(buf, NUMERIC_NAN) < 0 ||
+                Buffer_put_uint16(buf, 0) < 0)
+                goto done;
+            result = 0;
+            goto done;
+        }
+        Py_DECREF(is_nan);
+        PyErr_Format(PyExc_ValueError, "Cannot encode %R as numeric.", dec);
+        goto done;
+    }
+    exponent = PyLong_AsLong(exponent_obj);
+    if (exponent == -1 && PyErr_Occurred())
+        goto done;
+
+    dscale = exponent < 0 ? -exponent : 0;
+    num_digits = (long)PyTuple_GET_SIZE(digits_tuple);
+    if (exponent > 0) {
+        num_digits += exponent;
+        exponent = 0;
+    }
+    /* pad the fraction on the right and the integer part on the left so
+     * that both split into groups of four decimal digits */
+    fraction_length = -exponent + ((4 - (-exponent) % 4) % 4);
+    integer_length = num_digits - (-exponent);
+    if (integer_length < 0)
+        integer_length = 0;
+    left_pad = (4 - integer_length % 4) % 4;
+    num_padded = left_pad + integer_length + fraction_length;
+
+    digits = PyMem_Calloc(num_padded ? num_padded : 1, 1);
+    if (digits == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    /* the significant digits end where the fraction ends, before its
+     * right padding */
+    {
+        long last = left_pad + integer_length + (-exponent);
+        long count = (long)PyTuple_GET_SIZE(digits_tuple);
+        /* digits added by a positive exponent are zeros already */
+        long first = last - num_digits;
+        for (i = 0; i < count; i++) {
+            long digit = PyLong_AsLong(PyTuple_GET_ITEM(digits_tuple, i));
+            if (digit == -1 && PyErr_Occurred())
+                goto done;
+            digits[first + i] = (unsigned char)digit;
+        }
+    }
+
+    num_groups = num_padded / 4;
+    groups = PyMem_Malloc((num_groups ? num_groups : 1) * sizeof(unsigned int));
+    if (groups == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (i = 0; i < num_groups; i++) {
+        groups[i] = digits[4 * i] * 1000 + digits[4 * i + 1] * 100 +
+                    digits[4 * i + 2] * 10 + digits[4 * i + 3];
+    }
+    weight = (left_pad + integer_length) / 4 - 1;
+    start = 0;
+    end = num_groups;
+    while (start < end && groups[start] == 0) {
+        start++;
+        weight--;
+    }
+    while (end > start && groups[end - 1] == 0)
+        end--;
+    if (start == end)
+        weight = 0;
+
+    if (Buffer_put_int32(buf, 8 + 2 * (end - start)) < 0 ||
+        Buffer_put_uint16(buf, (unsigned int)(end - start)) < 0 ||
+        Buffer_put_uint16(buf, (unsigned int)(weight & 0xffff)) < 0 ||
+        Buffer_put_uint16(buf, sign ? NUMERIC_NEG : NUMERIC_POS) < 0 ||
+        Buffer_put_uint16(buf, (unsigned int)dscale) < 0)
+        goto done;
+    for (i = start; i < end; i++) {
+        if (Buffer_put_uint16(buf, groups[i]) < 0)
+            goto done;
+    }
+    result = 0;
+
+done:
+    PyMem_Free(digits);
+    PyMem_Free(groups);
+    Py_XDECREF(as_tuple);
+    Py_DECREF(dec);
+    return result;
+}
+
+static int
+encode_uuid(Buffer *buf, PyObject *value)
+{
+    PyObject *bytes;
+    int result;
+
+    bytes = PyObject_GetAttrString(value, "bytes");
+    if (bytes == NULL)
+        return -1;
+    if (!PyBytes_Check(bytes) || PyBytes_GET_SIZE(bytes) != 16) {
+        Py_DECREF(bytes);
+        PyErr_SetString(PyExc_TypeError, "uuid bytes must be 16 bytes long");
+        return -1;
+    }
+    result = Buffer_put_int32(buf, 16);
+    if (result == 0)
+        result = Buffer_put_bytes(buf, PyBytes_AS_STRING(bytes), 16);
+    Py_DECREF(bytes);
+    return result;
+}
+
+static int
+encode_value(Buffer *buf, int type_code, PyObject *value)
+{
+    if (value == Py_None)
+        return Buffer_put_int32(buf, -1);
+
+    switch (type_code) {
+    case PGCOPY_BOOL:
+    {
+        int truth = PyObject_IsTrue(value);
+        char byte;
+        if (truth < 0 || Buffer_put_int32(buf, 1) < 0)
+            return -1;
+        byte = (char)truth;
+        return Buffer_put_bytes(buf, &byte, 1);
+    }
+    case PGCOPY_INT2:
+        return encode_integer(buf, value, 2);
+    case PGCOPY_INT4:
+        return encode_integer(buf, value, 4);
+    case PGCOPY_INT8:
+        return encode_integer(buf, value, 8);
+    case PGCOPY_FLOAT4:
+        return encode_float(buf, value, 4);
+    case PGCOPY_FLOAT8:
+        return encode_float(buf, value, 8);
+    case PGCOPY_TEXT:
+        return encode_text(buf, value);
+    case PGCOPY_BYTEA:
+        return encode_bytea(buf, value);
+    case PGCOPY_DATE:
+        return encode_date(buf, value);
+    case PGCOPY_TIME:
+        return encode_time(buf, value);
+    case PGCOPY_TIMESTAMP:
+        return encode_timestamp(buf, value, 1);
+    case PGCOPY_TIMESTAMP_NAIVE:
+        return encode_timestamp(buf, value, 0);
+    case PGCOPY_INTERVAL:
+        return encode_interval(buf, value);
+    case PGCOPY_NUMERIC:
+        return encode_numeric(buf, value);
+    case PGCOPY_UUID:
+        return encode_uuid(buf, value);
+    }
+    PyErr_Format(PyExc_ValueError, "unknown type code %d", type_code);
+    return -1;
+}
+
+/*********************
+ * CopyBinaryEncoder *
+ *********************/
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *type_codes;
+    int *codes;
+    Py_ssize_t num_codes;
+} CopyBinaryEncoder;
+
+static int
+CopyBinaryEncoder_init(CopyBinaryEncoder *self, PyObject *args,
+                       PyObject *kwds)
+{
+    PyObject *type_codes, *codes_tuple;
+    Py_ssize_t i;
+
+    if (!PyArg_ParseTuple(args, "O", &type_codes))
+        return -1;
+
+    codes_tuple = PySequence_Tuple(type_codes);
+    if (codes_tuple == NULL)
+        return -1;
+
+    PyMem_Free(self->codes);
+    self->num_codes = PyTuple_GET_SIZE(codes_tuple);
+    self->codes = PyMem_Malloc((self->num_codes ? self->num_codes : 1) *
+                               sizeof(int));
+    if (self->codes == NULL) {
+        Py_DECREF(codes_tuple);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < self->num_codes; i++) {
+        long code = PyLong_AsLong(PyTuple_GET_ITEM(codes_tuple, i));
+        if (code == -1 && PyErr_Occurred()) {
+            Py_DECREF(codes_tuple);
+            return -1;
+        }
+        if (code < 0 || code >= PGCOPY_NUM_TYPES) {
+            PyErr_Format(PyExc_KeyError, "%ld", code);
+            Py_DECREF(codes_tuple);
+            return -1;
+        }
+        self->codes[i] = (int)code;
+    }
+
+    Py_XSETREF(self->type_codes, codes_tuple);
+    return 0;
+}
+
+static PyObject *
+CopyBinaryEncoder_encode(CopyBinaryEncoder *self, PyObject *rows)
+{
+    PyObject *iter, *row, *values_fastseq, *result;
+    PyObject **valueptr;
+    Buffer buf = {NULL, 0, 0};
+    Py_ssize_t i, num_values;
+
+    iter = PyObject_GetIter(rows);
+    if (iter == NULL)
+        return NULL;
+
+    while ((row = PyIter_Next(iter)) != NULL) {
+        values_fastseq = PySequence_Fast(row, "row must be a sequence");
+        Py_DECREF(row);
+        if (values_fastseq == NULL)
+            goto error;
+
+        num_values = PySequence_Fast_GET_SIZE(values_fastseq);
+        if (num_values != self->num_codes) {
+            PyErr_Format(PyExc_ValueError,
+                "Expected %d values in row, got %d.",
+                (int)self->num_codes, (int)num_values);
+            Py_DECREF(values_fastseq);
+            goto error;
+        }
+        if (Buffer_put_uint16(&buf, (unsigned int)num_values) < 0) {
+            Py_DECREF(values_fastseq);
+            goto error;
+        }
+        valueptr = PySequence_Fast_ITEMS(values_fastseq);
+        for (i = 0; i < num_values; i++) {
+            if (encode_value(&buf, self->codes[i], valueptr[i]) < 0) {
+                Py_DECREF(values_fastseq);
+                goto error;
+            }
+        }
+        Py_DECREF(values_fastseq);
+    }
+    if (PyErr_Occurred())
+        goto error;
+    Py_DECREF(iter);
+
+    result = PyBytes_FromStringAndSize(buf.data ? buf.data : "", buf.size);
+    PyMem_Free(buf.data);
+    return result;
+
+error:
+    Py_DECREF(iter);
+    PyMem_Free(buf.data);
+    return NULL;
+}
+
+static PyObject *
+CopyBinaryEncoder_get_type_codes(CopyBinaryEncoder *self, void *closure)
+{
+    if (self->type_codes == NULL)
+        Py_RETURN_NONE;
+    Py_INCREF(self->type_codes);
+    return self->type_codes;
+}
+
+static void
+CopyBinaryEncoder_dealloc(CopyBinaryEncoder *self)
+{
+    Py_XDECREF(self->type_codes);
+    PyMem_Free(self->codes);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyMethodDef CopyBinaryEncoder_methods[] = {
+    {"encode", (PyCFunction)CopyBinaryEncoder_encode, METH_O,
+     "Return the binary COPY tuples for the given rows as a bytes object."},
+    {NULL}  /* Sentinel */
+};
+
+static PyGetSetDef CopyBinaryEncoder_getseters[] = {
+    {"type_codes",
+     (getter)CopyBinaryEncoder_get_type_codes, NULL,
+     "the type code of each column",
+     NULL},
+    {NULL}
+};
+
+static PyTypeObject CopyBinaryEncoderType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "sqlalchemy.cpgcopy.CopyBinaryEncoder",     /* tp_name */
+    sizeof(CopyBinaryEncoder),                  /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)CopyBinaryEncoder_dealloc,      /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+    0,                                          /* tp_compare */
+    0,                                          /* tp_repr */
+    0,                                          /* tp_as_number */
+    0,                                          /* tp_as_sequence */
+    0,                                          /* tp_as_mapping */
+    0,                                          /* tp_hash  */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    0,                                          /* tp_getattro */
+    0,                                          /* tp_setattro */
+    0,                                          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,   /* tp_flags */
+    "PostgreSQL binary COPY encoder",           /* tp_doc */
+    0,                                          /* tp_traverse */
+    0,                                          /* tp_clear */
+    0,                                          /* tp_richcompare */
+    0,                                          /* tp_weaklistoffset */
+    0,                                          /* tp_iter */
+    0,                                          /* tp_iternext */
+    CopyBinaryEncoder_methods,                  /* tp_methods */
+    0,                                          /* tp_members */
+    CopyBinaryEncoder_getseters,                /* tp_getset */
+    0,                                          /* tp_base */
+    0,                                          /* tp_dict */
+    0,                                          /* tp_descr_get */
+    0,                                          /* tp_descr_set */
+    0,                                          /* tp_dictoffset */
+    (initproc)CopyBinaryEncoder_init,           /* tp_init */
+    0,                                          /* tp_alloc */
+    0,                                          /* tp_new */
+};
+
+static PyMethodDef module_methods[] = {
+    {NULL, NULL, 0, NULL}        /* Sentinel */
+};
+
+#ifndef PyMODINIT_FUNC  /* declarations for DLL import/export */
+#define PyMODINIT_FUNC void
+#endif
+
+static struct PyModuleDef module_def = {
+    PyModuleDef_HEAD_INIT,
+    MODULE_NAME,
+    MODULE_DOC,
+    -1,
+    module_methods
+};
+
+PyMODINIT_FUNC
+PyInit_cpgcopy(void)
+{
+    PyObject *m, *decimal_module;
+
+    CopyBinaryEncoderType.tp_new = PyType_GenericNew;
+    if (PyType_Ready(&CopyBinaryEncoderType) < 0)
+        return NULL;
+
+    decimal_module = PyImport_ImportModule("decimal");
+    if (decimal_module == NULL)
+        return NULL;
+    decimal_type = PyObject_GetAttrString(decimal_module, "Decimal");
+    Py_DECREF(decimal_module);
+    if (decimal_type == NULL)
+        return NULL;
+
+    m = PyModule_Create(&module_def);
+    if (m == NULL)
+        return NULL;
+
+    PyDateTime_IMPORT;
+
+    Py_INCREF(&CopyBinaryEncoderType);
+    PyModule_AddObject(m, "CopyBinaryEncoder",
+                       (PyObject *)&CopyBinaryEncoderType);
+
+    return m;
+}
@@ -824,10 +824,63 @@ static PyTypeObject tuplegetter_type = {
 };
 
 
+/****************************
+ * Instance dict population *
+ ****************************/
+
+/* Copy a contiguous range of a row into an instance __dict__, keyed by
+ * the given attribute names.  This is the hot loop of ORM object
+ * hydration: it avoids slicing the row and avoids running __init__ or any
+ * descriptor __set__ for each attribute.
+ */
+static PyObject *
+populate_dict(PyObject *self, PyObject *args)
+{
+    PyObject *dict, *keys, *row, *values_fastseq;
+    PyObject **keyptr, **valueptr;
+    Py_ssize_t start, num_keys, num_values, i;
+
+    if (!PyArg_ParseTuple(args, "O!O!On:populate_dict",
+                          &PyDict_Type, &dict, &PyTuple_Type, &keys,
+                          &row, &start))
+        return NULL;
+
+    if (PyObject_TypeCheck(row, &BaseRowType))
+        row = ((BaseRow *)row)->row;
+
+    values_fastseq = PySequence_Fast(row, "row must be a sequence");
+    if (values_fastseq == NULL)
+        return NULL;
+
+    num_keys = PyTuple_GET_SIZE(keys);
+    num_values = PySequence_Fast_GET_SIZE(values_fastseq);
+    if (start < 0 || start + num_keys > num_values) {
+        PyErr_Format(PyExc_IndexError,
+            "row of length %d has no range [%d:%d]",
+            (int)num_values, (int)start, (int)(start + num_keys));
+        Py_DECREF(values_fastseq);
+        return NULL;
+    }
+
+    keyptr = PySequence_Fast_ITEMS(keys);
+    valueptr = PySequence_Fast_ITEMS(values_fastseq) + start;
+    for (i = 0; i < num_keys; i++) {
+        if (PyDict_SetItem(dict, keyptr[i], valueptr[i]) < 0) {
+            Py_DECREF(values_fastseq);
+            return NULL;
+        }
+    }
+
+    Py_DECREF(values_fastseq);
+    Py_RETURN_NONE;
+}
+
 
 static PyMethodDef module_methods[] = {
     {"safe_rowproxy_reconstructor", safe_rowproxy_reconstructor, METH_VARARGS,
      "reconstruct a Row instance from its pickled form."},
+    {"populate_dict", populate_dict, METH_VARARGS,
+     "populate a dict from a range of a row, keyed by the given names."},
     {NULL, NULL, 0, NULL}        /* Sentinel */
 };
 
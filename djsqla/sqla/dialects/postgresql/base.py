@@ -2520,6 +2520,26 @@ class PGDialect(default.DefaultDialect):
         cursor.close()
         return val.upper()
 
+    def get_replication_lag(self, connection):
+        # the replay timestamp of an idle replica that has received
+        # everything only tells how long the primary has been idle
+        if self.server_version_info >= (10,):
+            caught_up = "pg_last_wal_receive_lsn() = pg_last_wal_replay_lsn()"
+        else:
+            caught_up = (
+                "pg_last_xlog_receive_location() = "
+                "pg_last_xlog_replay_location()"
+            )
+        cursor = connection.cursor()
+        cursor.execute(
+            "SELECT CASE WHEN NOT pg_is_in_recovery() OR %s THEN 0 "
+            "ELSE EXTRACT(EPOCH FROM now() - pg_last_xact_replay_timestamp()) "
+            "END" % caught_up
+        )
+        val = cursor.fetchone()[0]
+        cursor.close()
+        return None if val is None else float(val)
+
     def do_begin_twophase(self, connection, xid):
         self.do_begin(connection.connection)
 
@@ -2742,6 +2762,69 @@ class PGDialect(default.DefaultDialect):
             raise exc.NoSuchTableError(table_name)
         return table_oid
 
+    @reflection.cache
+    def _get_table_oids(self, connection, schema=None, **kw):
+        """Fetch the oids of all tables of a schema, like get_table_oid(),
+        as a dictionary keyed by table name."""
+        if schema is not None:
+            schema_where_clause = "n.nspname = :schema"
+        else:
+            schema_where_clause = "pg_catalog.pg_table_is_visible(c.oid)"
+        query = (
+            """
+            SELECT c.relname, c.oid
+            FROM pg_catalog.pg_class c
+            LEFT JOIN pg_catalog.pg_namespace n ON n.oid = c.relnamespace
+            WHERE (%s)
+            AND c.relkind in ('r', 'v', 'm', 'f', 'p')
+        """
+            % schema_where_clause
+        )
+        if schema is not None:
+            schema = util.text_type(schema)
+        s = sql.text(query).columns(
+            relname=sqltypes.Unicode, oid=sqltypes.Integer
+        )
+        if schema:
+            s = s.bindparams(sql.bindparam("schema", type_=sqltypes.Unicode))
+        c = connection.execute(s, schema=schema)
+        return dict(c.fetchall())
+
+    def _get_multi_oids(self, connection, schema, filter_names, **kw):
+        info_cache = kw.get("info_cache")
+        oids = self._get_table_oids(connection, schema, info_cache=info_cache)
+        if filter_names is not None:
+            oids = dict(
+                (name, oids[name]) for name in filter_names if name in oids
+            )
+        if info_cache is not None:
+            # seed get_table_oid(), used by the other reflection methods
+            for table_name, table_oid in oids.items():
+                key = reflection._cache_key(
+                    "get_table_oid", (table_name, schema), {}
+                )
+                info_cache[key] = table_oid
+        return oids
+
+    def _get_rows_by_oid(self, connection, query, oids, **column_types):
+        """Run a catalog query restricted to the tables of ``oids``, with
+        ``= ANY(:table_oids)``, and group its rows by their first column,
+        the table oid."""
+        t = (
+            sql.text(query)
+            .bindparams(
+                sql.bindparam(
+                    "table_oids", type_=sqltypes.ARRAY(sqltypes.Integer)
+                )
+            )
+            .columns(**column_types)
+        )
+        c = connection.execute(t, table_oids=list(oids.values()))
+        rows_by_oid = defaultdict(list)
+        for row in c.fetchall():
+            rows_by_oid[row[0]].append(row)
+        return rows_by_oid
+
     @reflection.cache
     def get_schema_names(self, connection, **kw):
         result = connection.execute(
@@ -2827,30 +2910,41 @@ class PGDialect(default.DefaultDialect):
         table_oid = self.get_table_oid(
             connection, table_name, schema, info_cache=kw.get("info_cache")
         )
+        return self._get_multi_columns(
+            connection, {table_name: table_oid}, schema
+        )[table_name]
+
+    def get_multi_columns(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        oids = self._get_multi_oids(connection, schema, filter_names, **kw)
+        return self._get_multi_columns(connection, oids, schema)
+
+    def _get_multi_columns(self, connection, oids, schema):
         SQL_COLS = """
-            SELECT a.attname,
+            SELECT a.attrelid as table_oid, a.attname,
               pg_catalog.format_type(a.atttypid, a.atttypmod),
               (SELECT pg_catalog.pg_get_expr(d.adbin, d.adrelid)
                 FROM pg_catalog.pg_attrdef d
                WHERE d.adrelid = a.attrelid AND d.adnum = a.attnum
                AND a.atthasdef)
               AS DEFAULT,
-              a.attnotnull, a.attnum, a.attrelid as table_oid,
+              a.attnotnull, a.attnum,
               pgd.description as comment
             FROM pg_catalog.pg_attribute a
             LEFT JOIN pg_catalog.pg_description pgd ON (
                 pgd.objoid = a.attrelid AND pgd.objsubid = a.attnum)
-            WHERE a.attrelid = :table_oid
+            WHERE a.attrelid = ANY(CAST(:table_oids AS oid[]))
             AND a.attnum > 0 AND NOT a.attisdropped
-            ORDER BY a.attnum
+            ORDER BY a.attrelid, a.attnum
         """
-        s = (
-            sql.text(SQL_COLS)
-            .bindparams(sql.bindparam("table_oid", type_=sqltypes.Integer))
-            .columns(attname=sqltypes.Unicode, default=sqltypes.Unicode)
+        rows_by_oid = self._get_rows_by_oid(
+            connection,
+            SQL_COLS,
+            oids,
+            attname=sqltypes.Unicode,
+            default=sqltypes.Unicode,
         )
-        c = connection.execute(s, table_oid=table_oid)
-        rows = c.fetchall()
 
         # dictionary with (name, ) if default search path or (schema, name)
         # as keys
@@ -2866,29 +2960,30 @@ class PGDialect(default.DefaultDialect):
         )
 
         # format columns
-        columns = []
-
-        for (
-            name,
-            format_type,
-            default_,
-            notnull,
-            attnum,
-            table_oid,
-            comment,
-        ) in rows:
-            column_info = self._get_column_info(
+        result = {}
+        for table_name, table_oid in oids.items():
+            columns = result[table_name] = []
+            for (
+                table_oid,
                 name,
                 format_type,
                 default_,
                 notnull,
-                domains,
-                enums,
-                schema,
+                attnum,
                 comment,
-            )
-            columns.append(column_info)
-        return columns
+            ) in rows_by_oid[table_oid]:
+                column_info = self._get_column_info(
+                    name,
+                    format_type,
+                    default_,
+                    notnull,
+                    domains,
+                    enums,
+                    schema,
+                    comment,
+                )
+                columns.append(column_info)
+        return result
 
     def _get_column_info(
         self,
@@ -3046,18 +3141,29 @@ class PGDialect(default.DefaultDialect):
         table_oid = self.get_table_oid(
             connection, table_name, schema, info_cache=kw.get("info_cache")
         )
+        return self._get_multi_pk_constraint(
+            connection, {table_name: table_oid}
+        )[table_name]
+
+    def get_multi_pk_constraint(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        oids = self._get_multi_oids(connection, schema, filter_names, **kw)
+        return self._get_multi_pk_constraint(connection, oids)
 
+    def _get_multi_pk_constraint(self, connection, oids):
         if self.server_version_info < (8, 4):
             PK_SQL = """
-                SELECT a.attname
+                SELECT t.oid, a.attname
                 FROM
                     pg_class t
                     join pg_index ix on t.oid = ix.indrelid
                     join pg_attribute a
                         on t.oid=a.attrelid AND %s
                  WHERE
-                  t.oid = :table_oid and ix.indisprimary = 't'
-                ORDER BY a.attnum
+                  t.oid = ANY(CAST(:table_oids AS oid[]))
+                  and ix.indisprimary = 't'
+                ORDER BY t.oid, a.attnum
             """ % self._pg_index_any(
                 "a.attnum", "ix.indkey"
             )
@@ -3066,31 +3172,40 @@ class PGDialect(default.DefaultDialect):
             # unnest() and generate_subscripts() both introduced in
             # version 8.4
             PK_SQL = """
-                SELECT a.attname
+                SELECT k.indrelid, a.attname
                 FROM pg_attribute a JOIN (
-                    SELECT unnest(ix.indkey) attnum,
+                    SELECT ix.indrelid,
+                           unnest(ix.indkey) attnum,
                            generate_subscripts(ix.indkey, 1) ord
                     FROM pg_index ix
-                    WHERE ix.indrelid = :table_oid AND ix.indisprimary
-                    ) k ON a.attnum=k.attnum
-                WHERE a.attrelid = :table_oid
-                ORDER BY k.ord
+                    WHERE ix.indrelid = ANY(CAST(:table_oids AS oid[]))
+                    AND ix.indisprimary
+                    ) k ON a.attrelid = k.indrelid AND a.attnum=k.attnum
+                ORDER BY k.indrelid, k.ord
             """
-        t = sql.text(PK_SQL).columns(attname=sqltypes.Unicode)
-        c = connection.execute(t, table_oid=table_oid)
-        cols = [r[0] for r in c.fetchall()]
+        cols_by_oid = self._get_rows_by_oid(
+            connection, PK_SQL, oids, attname=sqltypes.Unicode
+        )
 
         PK_CONS_SQL = """
-        SELECT conname
+        SELECT r.conrelid, r.conname
            FROM  pg_catalog.pg_constraint r
-           WHERE r.conrelid = :table_oid AND r.contype = 'p'
-           ORDER BY 1
+           WHERE r.conrelid = ANY(CAST(:table_oids AS oid[]))
+           AND r.contype = 'p'
+           ORDER BY 1, 2
         """
-        t = sql.text(PK_CONS_SQL).columns(conname=sqltypes.Unicode)
-        c = connection.execute(t, table_oid=table_oid)
-        name = c.scalar()
+        names_by_oid = self._get_rows_by_oid(
+            connection, PK_CONS_SQL, oids, conname=sqltypes.Unicode
+        )
 
-        return {"constrained_columns": cols, "name": name}
+        result = {}
+        for table_name, table_oid in oids.items():
+            names = names_by_oid[table_oid]
+            result[table_name] = {
+                "constrained_columns": [r[1] for r in cols_by_oid[table_oid]],
+                "name": names[0][1] if names else None,
+            }
+        return result
 
     @reflection.cache
     def get_foreign_keys(
@@ -3101,24 +3216,47 @@ class PGDialect(default.DefaultDialect):
         postgresql_ignore_search_path=False,
         **kw
     ):
-        preparer = self.identifier_preparer
         table_oid = self.get_table_oid(
             connection, table_name, schema, info_cache=kw.get("info_cache")
         )
+        return self._get_multi_foreign_keys(
+            connection,
+            {table_name: table_oid},
+            schema,
+            postgresql_ignore_search_path,
+        )[table_name]
+
+    def get_multi_foreign_keys(
+        self,
+        connection,
+        schema=None,
+        filter_names=None,
+        postgresql_ignore_search_path=False,
+        **kw
+    ):
+        oids = self._get_multi_oids(connection, schema, filter_names, **kw)
+        return self._get_multi_foreign_keys(
+            connection, oids, schema, postgresql_ignore_search_path
+        )
+
+    def _get_multi_foreign_keys(
+        self, connection, oids, schema, postgresql_ignore_search_path
+    ):
+        preparer = self.identifier_preparer
 
         FK_SQL = """
-          SELECT r.conname,
+          SELECT r.conrelid, r.conname,
                 pg_catalog.pg_get_constraintdef(r.oid, true) as condef,
                 n.nspname as conschema
           FROM  pg_catalog.pg_constraint r,
                 pg_namespace n,
                 pg_class c
 
-          WHERE r.conrelid = :table AND
+          WHERE r.conrelid = ANY(CAST(:table_oids AS oid[])) AND
                 r.contype = 'f' AND
                 c.oid = confrelid AND
                 n.oid = c.relnamespace
-          ORDER BY 1
+          ORDER BY 1, 2
         """
         # http://www.postgresql.org/docs/9.0/static/sql-createtable.html
         FK_REGEX = re.compile(
@@ -3132,80 +3270,87 @@ class PGDialect(default.DefaultDialect):
             r"[\s]?(INITIALLY (DEFERRED|IMMEDIATE)+)?"
         )
 
-        t = sql.text(FK_SQL).columns(
-            conname=sqltypes.Unicode, condef=sqltypes.Unicode
+        rows_by_oid = self._get_rows_by_oid(
+            connection,
+            FK_SQL,
+            oids,
+            conname=sqltypes.Unicode,
+            condef=sqltypes.Unicode,
         )
-        c = connection.execute(t, table=table_oid)
-        fkeys = []
-        for conname, condef, conschema in c.fetchall():
-            m = re.search(FK_REGEX, condef).groups()
+        result = {}
+        for table_name, table_oid in oids.items():
+            fkeys = result[table_name] = []
+            for _, conname, condef, conschema in rows_by_oid[table_oid]:
+                m = re.search(FK_REGEX, condef).groups()
 
-            (
-                constrained_columns,
-                referred_schema,
-                referred_table,
-                referred_columns,
-                _,
-                match,
-                _,
-                onupdate,
-                _,
-                ondelete,
-                deferrable,
-                _,
-                initially,
-            ) = m
-
-            if deferrable is not None:
-                deferrable = True if deferrable == "DEFERRABLE" else False
-            constrained_columns = [
-                preparer._unquote_identifier(x)
-                for x in re.split(r"\s*,\s*", constrained_columns)
-            ]
+                (
+                    constrained_columns,
+                    referred_schema,
+                    referred_table,
+                    referred_columns,
+                    _,
+                    match,
+                    _,
+                    onupdate,
+                    _,
+                    ondelete,
+                    deferrable,
+                    _,
+                    initially,
+                ) = m
+
+                if deferrable is not None:
+                    deferrable = True if deferrable == "DEFERRABLE" else False
+                constrained_columns = [
+                    preparer._unquote_identifier(x)
+                    for x in re.split(r"\s*,\s*", constrained_columns)
+                ]
 
-            if postgresql_ignore_search_path:
-                # when ignoring search path, we use the actual schema
-                # provided it isn't the "default" schema
-                if conschema != self.default_schema_name:
-                    referred_schema = conschema
-                else:
+                if postgresql_ignore_search_path:
+                    # when ignoring search path, we use the actual schema
+                    # provided it isn't the "default" schema
+                    if conschema != self.default_schema_name:
+                        referred_schema = conschema
+                    else:
+                        referred_schema = schema
+                elif referred_schema:
+                    # referred_schema is the schema that we regexp'ed from
+                    # pg_get_constraintdef().  If the schema is in the search
+                    # path, pg_get_constraintdef() will give us None.
+                    referred_schema = preparer._unquote_identifier(
+                        referred_schema
+                    )
+                elif schema is not None and schema == conschema:
+                    # If the actual schema matches the schema of the table
+                    # we're reflecting, then we will use that.
                     referred_schema = schema
-            elif referred_schema:
-                # referred_schema is the schema that we regexp'ed from
-                # pg_get_constraintdef().  If the schema is in the search
-                # path, pg_get_constraintdef() will give us None.
-                referred_schema = preparer._unquote_identifier(referred_schema)
-            elif schema is not None and schema == conschema:
-                # If the actual schema matches the schema of the table
-                # we're reflecting, then we will use that.
-                referred_schema = schema
-
-            referred_table = preparer._unquote_identifier(referred_table)
-            referred_columns = [
-                preparer._unquote_identifier(x)
-                for x in re.split(r"\s*,\s", referred_columns)
-            ]
-            options = {
-                k: v
-                for k, v in [
-                    ("onupdate", onupdate),
-                    ("ondelete", ondelete),
-                    ("initially", initially),
-                    ("deferrable", deferrable),
-                    ("match", match),
+
+                referred_table = preparer._unquote_identifier(referred_table)
+                referred_columns = [
+                    preparer._unquote_identifier(x)
+                    for x in re.split(r"\s*,\s", referred_columns)
                 ]
-                if v is not None and v != "NO ACTION"
-            }
-            fkey_d = {
-                "name": conname,
-                "constrained_columns": constrained_columns,
-                "referred_schema": referred_schema,
-                "referred_table": referred_table,
-                "referred_columns": referred_columns,
-                "options": options,
-            }
-            fkeys.append(fkey_d)
-        return fkeys
+                options = {
+                    k: v
+                    for k, v in [
+                        ("onupdate", onupdate),
+                        ("ondelete", ondelete),
+                        ("initially", initially),
+                        ("deferrable", deferrable),
+                        ("match", match),
+                    ]
+                    if v is not None and v != "NO ACTION"
+                }
+                fkey_d = {
+                    "name": conname,
+                    "constrained_columns": constrained_columns,
+                    "referred_schema": referred_schema,
+                    "referred_table": referred_table,
+                    "referred_columns": referred_columns,
+                    "options": options,
+                }
+                fkeys.append(fkey_d)
+        return result
 
     def _pg_index_any(self, col, compare_to):
         if self.server_version_info < (8, 1):
@@ -3226,14 +3371,24 @@ class PGDialect(default.DefaultDialect):
         table_oid = self.get_table_oid(
             connection, table_name, schema, info_cache=kw.get("info_cache")
         )
+        return self._get_multi_indexes(connection, {table_name: table_oid})[
+            table_name
+        ]
+
+    def get_multi_indexes(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        oids = self._get_multi_oids(connection, schema, filter_names, **kw)
+        return self._get_multi_indexes(connection, oids)
 
+    def _get_multi_indexes(self, connection, oids):
         # cast indkey as varchar since it's an int2vector,
         # returned as a list by some drivers such as pypostgresql
 
         if self.server_version_info < (8, 5):
             IDX_SQL = """
               SELECT
-                  i.relname as relname,
+                  t.oid, i.relname as relname,
                   ix.indisunique, ix.indexprs, ix.indpred,
                   a.attname, a.attnum, NULL, ix.indkey%s,
                   %s, %s, am.amname
@@ -3249,10 +3404,10 @@ class PGDialect(default.DefaultDialect):
                             on i.relam = am.oid
               WHERE
                   t.relkind IN ('r', 'v', 'f', 'm')
-                  and t.oid = :table_oid
+                  and t.oid = ANY(CAST(:table_oids AS oid[]))
                   and ix.indisprimary = 'f'
               ORDER BY
-                  t.relname,
+                  t.oid,
                   i.relname
             """ % (
                 # version 8.3 here was based on observing the
@@ -3270,7 +3425,7 @@ class PGDialect(default.DefaultDialect):
         else:
             IDX_SQL = """
               SELECT
-                  i.relname as relname,
+                  t.oid, i.relname as relname,
                   ix.indisunique, ix.indexprs, ix.indpred,
                   a.attname, a.attnum, c.conrelid, ix.indkey::varchar,
                   ix.indoption::varchar, i.reloptions, am.amname
@@ -3291,23 +3446,32 @@ class PGDialect(default.DefaultDialect):
                             on i.relam = am.oid
               WHERE
                   t.relkind IN ('r', 'v', 'f', 'm', 'p')
-                  and t.oid = :table_oid
+                  and t.oid = ANY(CAST(:table_oids AS oid[]))
                   and ix.indisprimary = 'f'
               ORDER BY
-                  t.relname,
+                  t.oid,
                   i.relname
             """
 
-        t = sql.text(IDX_SQL).columns(
-            relname=sqltypes.Unicode, attname=sqltypes.Unicode
+        rows_by_oid = self._get_rows_by_oid(
+            connection,
+            IDX_SQL,
+            oids,
+            relname=sqltypes.Unicode,
+            attname=sqltypes.Unicode,
+        )
+        return dict(
+            (table_name, self._get_indexes_from_rows(rows_by_oid[table_oid]))
+            for table_name, table_oid in oids.items()
         )
-        c = connection.execute(t, table_oid=table_oid)
 
+    def _get_indexes_from_rows(self, rows):
         indexes = defaultdict(lambda: defaultdict(dict))
 
         sv_idx_name = None
-        for row in c.fetchall():
+        for row in rows:
             (
+                _,
                 idx_name,
                 unique,
                 expr,
@@ -3413,9 +3577,20 @@ class PGDialect(default.DefaultDialect):
         table_oid = self.get_table_oid(
             connection, table_name, schema, info_cache=kw.get("info_cache")
         )
+        return self._get_multi_unique_constraints(
+            connection, {table_name: table_oid}
+        )[table_name]
 
+    def get_multi_unique_constraints(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        oids = self._get_multi_oids(connection, schema, filter_names, **kw)
+        return self._get_multi_unique_constraints(connection, oids)
+
+    def _get_multi_unique_constraints(self, connection, oids):
         UNIQUE_SQL = """
             SELECT
+                cons.conrelid as table_oid,
                 cons.conname as name,
                 cons.conkey as key,
                 a.attnum as col_num,
@@ -3426,80 +3601,117 @@ class PGDialect(default.DefaultDialect):
                   on cons.conrelid = a.attrelid AND
                     a.attnum = ANY(cons.conkey)
             WHERE
-                cons.conrelid = :table_oid AND
+                cons.conrelid = ANY(CAST(:table_oids AS oid[])) AND
                 cons.contype = 'u'
         """
 
-        t = sql.text(UNIQUE_SQL).columns(col_name=sqltypes.Unicode)
-        c = connection.execute(t, table_oid=table_oid)
-
-        uniques = defaultdict(lambda: defaultdict(dict))
-        for row in c.fetchall():
-            uc = uniques[row.name]
-            uc["key"] = row.key
-            uc["cols"][row.col_num] = row.col_name
+        rows_by_oid = self._get_rows_by_oid(
+            connection, UNIQUE_SQL, oids, col_name=sqltypes.Unicode
+        )
 
-        return [
-            {"name": name, "column_names": [uc["cols"][i] for i in uc["key"]]}
-            for name, uc in uniques.items()
-        ]
+        result = {}
+        for table_name, table_oid in oids.items():
+            uniques = defaultdict(lambda: defaultdict(dict))
+            for row in rows_by_oid[table_oid]:
+                uc = uniques[row.name]
+                uc["key"] = row.key
+                uc["cols"][row.col_num] = row.col_name
+
+            result[table_name] = [
+                {
+                    "name": name,
+                    "column_names": [uc["cols"][i] for i in uc["key"]],
+                }
+                for name, uc in uniques.items()
+            ]
+        return result
 
     @reflection.cache
     def get_table_comment(self, connection, table_name, schema=None, **kw):
         table_oid = self.get_table_oid(
             connection, table_name, schema, info_cache=kw.get("info_cache")
         )
+        return self._get_multi_table_comment(
+            connection, {table_name: table_oid}
+        )[table_name]
+
+    def get_multi_table_comment(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        oids = self._get_multi_oids(connection, schema, filter_names, **kw)
+        return self._get_multi_table_comment(connection, oids)
 
+    def _get_multi_table_comment(self, connection, oids):
         COMMENT_SQL = """
             SELECT
+                pgd.objoid as table_oid,
                 pgd.description as table_comment
             FROM
                 pg_catalog.pg_description pgd
             WHERE
                 pgd.objsubid = 0 AND
-                pgd.objoid = :table_oid
+                pgd.objoid = ANY(CAST(:table_oids AS oid[]))
         """
 
-        c = connection.execute(sql.text(COMMENT_SQL), table_oid=table_oid)
-        return {"text": c.scalar()}
+        rows_by_oid = self._get_rows_by_oid(connection, COMMENT_SQL, oids)
+        result = {}
+        for table_name, table_oid in oids.items():
+            rows = rows_by_oid[table_oid]
+            result[table_name] = {"text": rows[0][1] if rows else None}
+        return result
 
     @reflection.cache
     def get_check_constraints(self, connection, table_name, schema=None, **kw):
         table_oid = self.get_table_oid(
             connection, table_name, schema, info_cache=kw.get("info_cache")
         )
+        return self._get_multi_check_constraints(
+            connection, {table_name: table_oid}
+        )[table_name]
+
+    def get_multi_check_constraints(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        oids = self._get_multi_oids(connection, schema, filter_names, **kw)
+        return self._get_multi_check_constraints(connection, oids)
 
+    def _get_multi_check_constraints(self, connection, oids):
         CHECK_SQL = """
             SELECT
+                cons.conrelid as table_oid,
                 cons.conname as name,
                 pg_get_constraintdef(cons.oid) as src
             FROM
                 pg_catalog.pg_constraint cons
             WHERE
-                cons.conrelid = :table_oid AND
+                cons.conrelid = ANY(CAST(:table_oids AS oid[])) AND
                 cons.contype = 'c'
         """
 
-        c = connection.execute(sql.text(CHECK_SQL), table_oid=table_oid)
-
-        ret = []
-        for name, src in c:
-            # samples:
-            # "CHECK (((a > 1) AND (a < 5)))"
-            # "CHECK (((a = 1) OR ((a > 2) AND (a < 5))))"
-            # "CHECK (((a > 1) AND (a < 5))) NOT VALID"
-            m = re.match(r"^CHECK *\(\((.+)\)\)( NOT VALID)?$", src)
-            if not m:
-                util.warn("Could not parse CHECK constraint text: %r" % src)
-                sqltext = ""
-            else:
-                sqltext = m.group(1)
-            entry = {"name": name, "sqltext": sqltext}
-            if m and m.group(2):
-                entry["dialect_options"] = {"not_valid": True}
+        rows_by_oid = self._get_rows_by_oid(connection, CHECK_SQL, oids)
+
+        result = {}
+        for table_name, table_oid in oids.items():
+            ret = result[table_name] = []
+            for _, name, src in rows_by_oid[table_oid]:
+                # samples:
+                # "CHECK (((a > 1) AND (a < 5)))"
+                # "CHECK (((a = 1) OR ((a > 2) AND (a < 5))))"
+                # "CHECK (((a > 1) AND (a < 5))) NOT VALID"
+                m = re.match(r"^CHECK *\(\((.+)\)\)( NOT VALID)?$", src)
+                if not m:
+                    util.warn(
+                        "Could not parse CHECK constraint text: %r" % src
+                    )
+                    sqltext = ""
+                else:
+                    sqltext = m.group(1)
+                entry = {"name": name, "sqltext": sqltext}
+                if m and m.group(2):
+                    entry["dialect_options"] = {"not_valid": True}
 
-            ret.append(entry)
-        return ret
+                ret.append(entry)
+        return result
 
     def _load_enums(self, connection, schema=None):
         schema = schema or self.default_schema_name
@@ -850,6 +850,58 @@ class PGDialect_psycopg2(PGDialect):
         else:
             return None
 
+    # each statement of a batch appends its rowcount to a transaction-local
+    # setting, which the last statement of the round trip reads back
+    _batch_reset = b"SELECT set_config('sqlalchemy.batch_rowcounts', '', true)"
+    _batch_statement = (
+        b"WITH batch_rows AS (%s RETURNING 1) "
+        b"SELECT set_config('sqlalchemy.batch_rowcounts', "
+        b"current_setting('sqlalchemy.batch_rowcounts') || ' ' || count(*), "
+        b"true) FROM batch_rows"
+    )
+    _batch_result = b"SELECT current_setting('sqlalchemy.batch_rowcounts')"
+
+    def do_execute_batch(self, batch):
+        page_size = self.executemany_batch_page_size or 100
+        rowcounts = []
+        pending = []
+        for statement, parameters, context in batch:
+            if context.is_crud and not (
+                context._is_explicit_returning
+                or context._is_implicit_returning
+            ):
+                pending.append(context.cursor.mogrify(statement, parameters))
+                if len(pending) == page_size:
+                    self._execute_pending_batch(
+                        context.cursor, pending, rowcounts
+                    )
+                    pending = []
+            else:
+                if pending:
+                    self._execute_pending_batch(
+                        context.cursor, pending, rowcounts
+                    )
+                    pending = []
+                context.cursor.execute(statement, parameters)
+                rowcounts.append(context.cursor.rowcount)
+        if pending:
+            self._execute_pending_batch(batch[-1][2].cursor, pending, rowcounts)
+        return rowcounts
+
+    def _execute_pending_batch(self, cursor, statements, rowcounts):
+        if len(statements) == 1:
+            cursor.execute(statements[0])
+            rowcounts.append(cursor.rowcount)
+            return
+        cursor.execute(
+            b";".join(
+                [self._batch_reset]
+                + [self._batch_statement % statement for statement in statements]
+                + [self._batch_result]
+            )
+        )
+        rowcounts.extend(int(count) for count in cursor.fetchone()[0].split())
+
     def do_executemany(self, cursor, statement, parameters, context=None):
         if self.executemany_mode is EXECUTEMANY_DEFAULT:
             cursor.executemany(statement, parameters)
@@ -1438,6 +1438,7 @@ class SQLiteDialect(default.DefaultDialect):
 
     _broken_fk_pragma_quotes = False
     _broken_dotted_colnames = False
+    _supports_table_valued_pragmas = False
 
     @util.deprecated_params(
         _json_serializer=(
@@ -1512,6 +1513,10 @@ class SQLiteDialect(default.DefaultDialect):
                 6,
                 14,
             )
+            # pragma_table_info() etc. can be joined to sqlite_master
+            self._supports_table_valued_pragmas = (
+                self.dbapi.sqlite_version_info >= (3, 16, 0)
+            )
 
     _isolation_lookup = {"READ UNCOMMITTED": 1, "SERIALIZABLE": 0}
 
@@ -1567,6 +1572,9 @@ class SQLiteDialect(default.DefaultDialect):
 
         return [db[1] for db in dl if db[1] != "temp"]
 
+    def get_schema_version(self, connection):
+        return connection.execute("PRAGMA schema_version").scalar()
+
     @reflection.cache
     def get_table_names(self, connection, schema=None, **kw):
         if schema is not None:
@@ -1654,7 +1662,11 @@ class SQLiteDialect(default.DefaultDialect):
     @reflection.cache
     def get_columns(self, connection, table_name, schema=None, **kw):
         info = self._get_table_pragma(
-            connection, "table_info", table_name, schema=schema
+            connection,
+            "table_info",
+            table_name,
+            schema=schema,
+            info_cache=kw.get("info_cache"),
         )
 
         columns = []
@@ -1746,7 +1758,9 @@ class SQLiteDialect(default.DefaultDialect):
     @reflection.cache
     def get_pk_constraint(self, connection, table_name, schema=None, **kw):
         constraint_name = None
-        table_data = self._get_table_sql(connection, table_name, schema=schema)
+        table_data = self._get_table_sql(
+            connection, table_name, schema=schema, **kw
+        )
         if table_data:
             PK_PATTERN = r"CONSTRAINT (\w+) PRIMARY KEY"
             result = re.search(PK_PATTERN, table_data, re.I)
@@ -1765,7 +1779,11 @@ class SQLiteDialect(default.DefaultDialect):
         # sqlite makes this *extremely difficult*.
         # First, use the pragma to get the actual FKs.
         pragma_fks = self._get_table_pragma(
-            connection, "foreign_key_list", table_name, schema=schema
+            connection,
+            "foreign_key_list",
+            table_name,
+            schema=schema,
+            info_cache=kw.get("info_cache"),
         )
 
         fks = {}
@@ -1834,7 +1852,9 @@ class SQLiteDialect(default.DefaultDialect):
             for fk in fks.values()
         )
 
-        table_data = self._get_table_sql(connection, table_name, schema=schema)
+        table_data = self._get_table_sql(
+            connection, table_name, schema=schema, **kw
+        )
         if table_data is None:
             # system tables, etc.
             return []
@@ -1996,7 +2016,11 @@ class SQLiteDialect(default.DefaultDialect):
     @reflection.cache
     def get_indexes(self, connection, table_name, schema=None, **kw):
         pragma_indexes = self._get_table_pragma(
-            connection, "index_list", table_name, schema=schema
+            connection,
+            "index_list",
+            table_name,
+            schema=schema,
+            info_cache=kw.get("info_cache"),
         )
         indexes = []
 
@@ -2013,7 +2037,11 @@ class SQLiteDialect(default.DefaultDialect):
         # loop thru unique indexes to get the column names.
         for idx in list(indexes):
             pragma_index = self._get_table_pragma(
-                connection, "index_info", idx["name"]
+                connection,
+                "index_info",
+                idx["name"],
+                schema=schema,
+                info_cache=kw.get("info_cache"),
             )
 
             for row in pragma_index:
@@ -2030,6 +2058,9 @@ class SQLiteDialect(default.DefaultDialect):
 
     @reflection.cache
     def _get_table_sql(self, connection, table_name, schema=None, **kw):
+        batch = self._get_pragma_batch(kw.get("info_cache"), "sql", schema)
+        if table_name in batch:
+            return batch[table_name]
         if schema:
             schema_expr = "%s." % (
                 self.identifier_preparer.quote_identifier(schema)
@@ -2056,7 +2087,13 @@ class SQLiteDialect(default.DefaultDialect):
             rs = connection.execute(s)
         return rs.scalar()
 
-    def _get_table_pragma(self, connection, pragma, table_name, schema=None):
+    def _get_table_pragma(
+        self, connection, pragma, table_name, schema=None, info_cache=None
+    ):
+        batch = self._get_pragma_batch(info_cache, pragma, schema)
+        if table_name in batch:
+            return batch[table_name]
+
         quote = self.identifier_preparer.quote_identifier
         if schema is not None:
             statements = ["PRAGMA %s." % quote(schema)]
@@ -2082,3 +2119,68 @@ class SQLiteDialect(default.DefaultDialect):
                 return result
         else:
             return []
+
+    def _get_pragma_batch(self, info_cache, pragma, schema):
+        if info_cache is None:
+            return {}
+        return info_cache.get(("_sqlite_pragma_batch", pragma, schema), {})
+
+    def _prefetch_pragmas(self, connection, schema, info_cache):
+        """Run the pragmas used by reflection for all tables of a schema at
+        once, with one query per pragma joining sqlite_master to the table
+        valued form of the pragma.  _get_table_pragma() and _get_table_sql()
+        read their results from ``info_cache``; temp tables, which aren't
+        covered, still run one pragma each.
+
+        """
+        if ("_sqlite_pragma_batch", "sql", schema) in info_cache:
+            return
+        quote = self.identifier_preparer.quote_identifier
+        if schema is not None:
+            master = "%s.sqlite_master" % quote(schema)
+            schema_arg = "'%s'" % schema.replace("'", "''")
+        else:
+            master = "main.sqlite_master"
+            schema_arg = "'main'"
+
+        entries = connection.execute(
+            "SELECT type, name, sql FROM %s" % master
+        ).fetchall()
+        for pragma, types in (
+            ("table_info", ("table", "view")),
+            ("foreign_key_list", ("table",)),
+            ("index_list", ("table",)),
+            ("index_info", ("index",)),
+        ):
+            batch = dict(
+                (name, []) for type_, name, sql in entries if type_ in types
+            )
+            # no ORDER BY, the rows of each name come in pragma order
+            rows = connection.execute(
+                "SELECT m.name, p.* FROM %s AS m "
+                "JOIN pragma_%s(m.name, %s) AS p "
+                "WHERE m.type IN (%s)"
+                % (
+                    master,
+                    pragma,
+                    schema_arg,
+                    ", ".join("'%s'" % type_ for type_ in types),
+                )
+            )
+            for row in rows:
+                batch[row[0]].append(tuple(row[1:]))
+            info_cache[("_sqlite_pragma_batch", pragma, schema)] = batch
+
+        info_cache[("_sqlite_pragma_batch", "sql", schema)] = dict(
+            (name, sql) for type_, name, sql in entries if type_ == "table"
+        )
+
+    def _default_multi_reflect(
+        self, single_method, connection, schema=None, filter_names=None, **kw
+    ):
+        info_cache = kw.get("info_cache")
+        if info_cache is not None and self._supports_table_valued_pragmas:
+            self._prefetch_pragmas(connection, schema, info_cache)
+        return super(SQLiteDialect, self)._default_multi_reflect(
+            single_method, connection, schema, filter_names, **kw
+        )
@@ -310,10 +310,51 @@ by adding the desired locking mode to our ``"BEGIN"``::
     `sqlite3 module breaks transactions and potentially corrupts data <http://bugs.python.org/issue10740>`_ -
     on the Python bug tracker
 
+.. _pysqlite_single_writer:
+
+Single writer mode
+------------------
+
+SQLite allows one writer at a time; threads writing through their own
+connections wait on the database lock, retrying until ``timeout`` expires
+or failing with ``database is locked``.  With ``single_writer=True``, a
+file-based engine routes writes through one dedicated connection and
+thread, available as ``engine.dialect.write_queue``, and every connection
+uses the WAL journal so that reads proceed while it writes::
+
+    engine = create_engine("sqlite:///myfile.db", single_writer=True)
+
+    result = engine.dialect.write_queue.execute(
+        table.insert(), {"data": "a"}
+    )
+    result.inserted_primary_key
+
+    def transfer(conn, amount):
+        conn.execute(debit.values(amount=amount))
+        conn.execute(credit.values(amount=amount))
+        return amount
+
+    engine.dialect.write_queue.run(transfer, 10)
+
+The calls block until the writer thread has committed them.  Calls queued
+while it was busy are committed together in a single transaction of up to
+``group_commit_size`` calls (64 by default), optionally waiting
+``group_commit_delay`` seconds for more of them.  Each call runs within a
+SAVEPOINT, so that an exception raised by one of them rolls back its own
+statements only and is re-raised in its caller; the others still commit.
+Callables must not begin, commit or roll back transactions themselves.
+Should the writer thread stop on an error, such as failing to connect, the
+calls it had not committed raise that error and the next call starts a new
+thread.
+
+Writes executed through other connections of the engine bypass the queue
+and contend for the lock as usual.
+
 
 """  # noqa
 
 import os
+import time
 
 from .base import DATE
 from .base import DATETIME
@@ -322,6 +363,7 @@ from ... import exc
 from ... import pool
 from ... import types as sqltypes
 from ... import util
+from ...util import queue as sqla_queue
 
 
 class _SQLite_pysqliteTimeStamp(DATETIME):
@@ -368,6 +410,47 @@ class SQLiteDialect_pysqlite(SQLiteDialect):
 
     driver = "pysqlite"
 
+    def __init__(
+        self,
+        single_writer=False,
+        group_commit_size=64,
+        group_commit_delay=0,
+        **kwargs
+    ):
+        SQLiteDialect.__init__(self, **kwargs)
+        self.single_writer = single_writer
+        self.group_commit_size = group_commit_size
+        self.group_commit_delay = group_commit_delay
+        self.write_queue = None
+
+    @classmethod
+    def engine_created(cls, engine):
+        dialect = engine.dialect
+        if not getattr(dialect, "single_writer", False):
+            return
+        if isinstance(engine.pool, pool.SingletonThreadPool):
+            raise exc.ArgumentError(
+                "single_writer requires a file-based SQLite database"
+            )
+        dialect.write_queue = SQLiteWriteQueue(
+            engine, dialect.group_commit_size, dialect.group_commit_delay
+        )
+
+    def on_connect(self):
+        connect = super(SQLiteDialect_pysqlite, self).on_connect()
+        if not self.single_writer:
+            return connect
+
+        def set_wal(conn):
+            # readers don't block the writer nor wait for it in WAL mode
+            cursor = conn.cursor()
+            cursor.execute("PRAGMA journal_mode=WAL")
+            cursor.close()
+            if connect is not None:
+                connect(conn)
+
+        return set_wal
+
     @classmethod
     def dbapi(cls):
         if util.py2k:
@@ -456,4 +539,182 @@ class SQLiteDialect_pysqlite(SQLiteDialect):
         ) and "Cannot operate on a closed database." in str(e)
 
 
+class _WriteRequest(object):
+    __slots__ = ("fn", "args", "kw", "done", "result", "error")
+
+    def __init__(self, fn, args, kw):
+        self.fn = fn
+        self.args = args
+        self.kw = kw
+        self.done = util.threading.Event()
+        self.result = None
+        self.error = None
+
+
+class SQLiteWriteQueue(object):
+    """Serializes the writes of an :class:`.Engine` through one connection
+    owned by a writer thread, committing the writes queued meanwhile
+    together.
+
+    See :ref:`pysqlite_single_writer`.
+
+    """
+
+    def __init__(self, engine, group_commit_size=64, group_commit_delay=0):
+        self.engine = engine
+        self.group_commit_size = group_commit_size
+        self.group_commit_delay = group_commit_delay
+        self.commits = 0
+        self.writes = 0
+        # each writer thread has a queue of its own, replaced along with
+        # the thread once it stops
+        self._queue = None
+        self._thread = None
+        self._lock = util.threading.Lock()
+
+    def run(self, fn, *args, **kw):
+        """Call ``fn(connection, *args, **kw)`` on the writer connection and
+        return its result once committed, or raise its exception."""
+        request = _WriteRequest(fn, args, kw)
+        with self._lock:
+            if self._thread is None:
+                self._start()
+            self._queue.put(request)
+        request.done.wait()
+        if request.error is not None:
+            raise request.error
+        return request.result
+
+    def execute(self, statement, *multiparams, **params):
+        """Execute a write statement on the writer connection."""
+        return self.run(_execute, statement, multiparams, params)
+
+    def close(self):
+        """Stop the writer thread once the queued writes are done."""
+        with self._lock:
+            thread = self._thread
+            if thread is None:
+                return
+            self._queue.put(None)
+            self._queue = self._thread = None
+        thread.join()
+
+    def _start(self):
+        # called with self._lock held
+        self._queue = sqla_queue.Queue()
+        self._thread = util.threading.Thread(
+            target=self._run,
+            args=(self._queue,),
+            name="sqlalchemy-sqlite-writer",
+        )
+        self._thread.daemon = True
+        self._thread.start()
+
+    def _next_batch(self, queue):
+        batch = [queue.get()]
+        if batch[0] is None:
+            return None
+        deadline = time.time() + self.group_commit_delay
+        while len(batch) < self.group_commit_size:
+            timeout = deadline - time.time()
+            try:
+                if timeout > 0:
+                    request = queue.get(timeout=timeout)
+                else:
+                    request = queue.get_nowait()
+            except sqla_queue.Empty:
+                break
+            if request is None:
+                # stop after this batch
+                queue.put(None)
+                break
+            batch.append(request)
+        return batch
+
+    def _run(self, queue):
+        batch = None
+        try:
+            conn = self.engine.connect().execution_options(autocommit=False)
+            try:
+                # BEGIN IMMEDIATE below takes the write lock up front;
+                # pysqlite mustn't begin or commit transactions on its own
+                conn.connection.connection.isolation_level = None
+                while True:
+                    batch = self._next_batch(queue)
+                    if batch is None:
+                        return
+                    self._write(conn, batch)
+            finally:
+                # don't hand the altered connection out again
+                conn.invalidate()
+                conn.close()
+        except BaseException as err:
+            self._abandon(queue, batch, err)
+            # the callers get errors; only let exits and interrupts through
+            if not isinstance(err, Exception):
+                raise
+
+    def _abandon(self, queue, batch, err):
+        """Fail the requests of a writer thread stopped by ``err``, so that
+        their callers don't wait forever; the next request starts a new
+        thread."""
+        with self._lock:
+            if self._queue is queue:
+                self._queue = self._thread = None
+        # nothing is put on the queue anymore
+        requests = [
+            request for request in batch or () if not request.done.is_set()
+        ]
+        while True:
+            try:
+                request = queue.get_nowait()
+            except sqla_queue.Empty:
+                break
+            if request is not None:
+                requests.append(request)
+        for request in requests:
+            request.result = None
+            request.error = err
+            request.done.set()
+
+    def _write(self, conn, batch):
+        savepoints = len(batch) > 1
+        try:
+            trans = conn.begin()
+            conn.connection.cursor().execute("BEGIN IMMEDIATE")
+            try:
+                for request in batch:
+                    savepoint = conn.begin_nested() if savepoints else None
+                    try:
+                        request.result = request.fn(
+                            conn, *request.args, **request.kw
+                        )
+                    except Exception as err:
+                        if savepoint is None:
+                            raise
+                        savepoint.rollback()
+                        request.error = err
+                    else:
+                        if savepoint is not None:
+                            savepoint.commit()
+                trans.commit()
+            except:  # noqa
+                trans.rollback()
+                raise
+        except Exception as err:
+            for request in batch:
+                if request.error is None:
+                    request.result = None
+                    request.error = err
+        else:
+            self.commits += 1
+        self.writes += len(batch)
+        for request in batch:
+            request.done.set()
+
+
+def _execute(conn, statement, multiparams, params):
+    return conn.execute(statement, *multiparams, **params)
+
+
 dialect = SQLiteDialect_pysqlite
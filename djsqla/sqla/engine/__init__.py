@@ -39,8 +39,15 @@ from .result import BufferedRowResultProxy  # noqa
 from .result import FullyBufferedResultProxy  # noqa
 from .result import ResultProxy  # noqa
 from .result import Row  # noqa
+from .routing import create_routing_engine
+from .routing import RoutingEngine  # noqa
 from .util import connection_memoize  # noqa
 from ..sql import ddl  # noqa
 
 
-__all__ = ("create_engine", "engine_from_config", "create_mock_engine")
+__all__ = (
+    "create_engine",
+    "engine_from_config",
+    "create_mock_engine",
+    "create_routing_engine",
+)
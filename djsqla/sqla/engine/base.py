@@ -7,6 +7,7 @@
 from __future__ import with_statement
 
 import contextlib
+import itertools
 import sys
 
 from .interfaces import Connectable
@@ -984,6 +985,148 @@ class Connection(Connectable):
         else:
             return meth(self, multiparams, params)
 
+    def execute_batch(self, statements):
+        """Execute a sequence of ``(statement, parameters)`` pairs and
+        return a list with the number of rows matched by each statement.
+
+        ``statement`` is a plain string or an executable construct, and
+        ``parameters`` a dictionary (or, for plain strings, whatever the
+        DBAPI accepts) or None.  Consecutive executions of the same
+        statement share one compiled form and execution context.  Dialects
+        may send the batch in fewer round trips; psycopg2 sends runs of
+        INSERT, UPDATE and DELETE statements without RETURNING as a single
+        query.
+
+        No result rows are returned.  If no transaction is in progress, the
+        batch runs in one which is committed at the end.  When connection
+        or engine events are established, the statements are simply
+        executed one at a time.
+
+        """
+        if self.in_transaction():
+            return self._execute_batch(statements)
+        with self.begin():
+            return self._execute_batch(statements)
+
+    def _execute_batch(self, statements):
+        statements = [
+            (statement, parameters if parameters is not None else {})
+            for statement, parameters in statements
+        ]
+        if self._has_events or self.engine._has_events:
+            return [
+                self.execute(statement, parameters).rowcount
+                for statement, parameters in statements
+            ]
+
+        try:
+            conn = self.__connection
+        except AttributeError:
+            conn = None
+        if conn is None:
+            conn = self._revalidate_connection()
+
+        if self._root.__transaction and not self._root.__transaction.is_active:
+            raise exc.InvalidRequestError(
+                "This connection is on an inactive transaction.  "
+                "Please rollback() fully before proceeding.",
+                code="8s2a",
+            )
+
+        dialect = self.dialect
+        contexts = []
+        batch = []
+        try:
+            for statement, parameters in self._compile_batch(statements):
+                try:
+                    if isinstance(statement, util.string_types[0]):
+                        context = dialect.execution_ctx_cls._init_statement(
+                            dialect, self, conn, statement, parameters
+                        )
+                    else:
+                        context = dialect.execution_ctx_cls._init_compiled(
+                            dialect, self, conn, statement, parameters
+                        )
+                except BaseException as e:
+                    self._handle_dbapi_exception(
+                        e, util.text_type(statement), parameters, None, None
+                    )
+                contexts.append(context)
+                if context.compiled:
+                    context.pre_exec()
+                batch.extend(
+                    (context.statement, params, context)
+                    for params in context.parameters
+                )
+
+            if self._echo:
+                for statement, parameters, context in batch:
+                    self.engine.logger.info(statement)
+                    if not self.engine.hide_parameters:
+                        self.engine.logger.info(
+                            "%r", sql_util._repr_params(parameters, batches=10)
+                        )
+
+            try:
+                rowcounts = dialect.do_execute_batch(batch)
+            except BaseException as e:
+                self._handle_dbapi_exception(
+                    e,
+                    ";\n".join(
+                        util.unique_list(statement for statement, _, _ in batch)
+                    ),
+                    [parameters for _, parameters, _ in batch],
+                    None,
+                    None,
+                )
+            for context in contexts:
+                if context.compiled:
+                    context.post_exec()
+        finally:
+            for context in contexts:
+                self._safe_close_cursor(context.cursor)
+        return rowcounts
+
+    def _compile_batch(self, statements):
+        """Yield ``(statement, parameter_sets)`` for the runs of consecutive
+        executions of a same statement, compiling each construct once per
+        set of parameter keys."""
+
+        schema_translate_map = (
+            self.schema_for_object
+            if not self.schema_for_object.is_default
+            else None
+        )
+        compiled_cache = {}
+        for _, run in itertools.groupby(
+            statements, key=lambda item: id(item[0])
+        ):
+            run = list(run)
+            statement = run[0][0]
+            parameters = [params for _, params in run]
+            if isinstance(statement, util.string_types[0]):
+                yield statement, parameters
+                continue
+            for keys, params in itertools.groupby(
+                parameters, key=lambda params: tuple(sorted(params))
+            ):
+                key = (id(statement), keys)
+                compiled = compiled_cache.get(key)
+                if compiled is None:
+                    compiled = compiled_cache[key] = statement.compile(
+                        dialect=self.dialect,
+                        column_keys=list(keys),
+                        inline=True,
+                        schema_translate_map=schema_translate_map,
+                    )
+                params = list(params)
+                if compiled.literal_execute_params:
+                    # expanding parameters are rendered per execution
+                    for single in params:
+                        yield compiled, [single]
+                else:
+                    yield compiled, params
+
     def _execute_function(self, func, multiparams, params):
         """Execute a sql.FunctionElement object."""
 
@@ -197,6 +197,15 @@ def create_engine(url, **kwargs):
         be applied to all connections.  See
         :meth:`~sqlalchemy.engine.Connection.execution_options`
 
+    :param expanding_in_padding=False: if True, the values of "expanding"
+        IN parameters are padded to the next power of two by repeating the
+        last value, so that the rendered statement only varies with the
+        size bucket rather than with every distinct number of values.  This
+        keeps the database's statement cache and tools such as
+        ``pg_stat_statements`` from being flooded by IN lists of varying
+        length.  May also be set per connection or statement with the
+        ``expanding_in_padding`` execution option.
+
     :param hide_parameters: Boolean, when set to True, SQL statement parameters
         will not be displayed in INFO logging nor will they be formatted into
         the string representation of :class:`.StatementError` objects.
@@ -76,6 +76,8 @@ class DefaultDialect(interfaces.Dialect):
 
     tuple_in_values = False
 
+    expanding_in_padding = False
+
     engine_config_types = util.immutabledict(
         [
             ("convert_unicode", util.bool_or_str("force")),
@@ -85,6 +87,7 @@ class DefaultDialect(interfaces.Dialect):
             ("pool_recycle", util.asint),
             ("pool_size", util.asint),
             ("max_overflow", util.asint),
+            ("expanding_in_padding", util.asbool),
         ]
     )
 
@@ -206,6 +209,7 @@ class DefaultDialect(interfaces.Dialect):
         empty_in_strategy="static",
         max_identifier_length=None,
         label_length=None,
+        expanding_in_padding=False,
         **kwargs
     ):
 
@@ -253,6 +257,7 @@ class DefaultDialect(interfaces.Dialect):
                 self._user_defined_max_identifier_length
             )
         self.label_length = label_length
+        self.expanding_in_padding = expanding_in_padding
 
         if self.description_encoding == "use_encoding":
             self._description_decoder = (
@@ -451,6 +456,74 @@ class DefaultDialect(interfaces.Dialect):
             )
         }
 
+    def _default_multi_reflect(
+        self, single_method, connection, schema=None, filter_names=None, **kw
+    ):
+        """Implement a ``get_multi_*`` method with one call of the
+        corresponding ``get_*`` method per table."""
+        if filter_names is None:
+            filter_names = self.get_table_names(
+                connection, schema, info_cache=kw.get("info_cache")
+            )
+        result = {}
+        for table_name in filter_names:
+            try:
+                result[table_name] = single_method(
+                    connection, table_name, schema, **kw
+                )
+            except exc.NoSuchTableError:
+                pass
+        return result
+
+    def get_multi_columns(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        return self._default_multi_reflect(
+            self.get_columns, connection, schema, filter_names, **kw
+        )
+
+    def get_multi_pk_constraint(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        return self._default_multi_reflect(
+            self.get_pk_constraint, connection, schema, filter_names, **kw
+        )
+
+    def get_multi_foreign_keys(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        return self._default_multi_reflect(
+            self.get_foreign_keys, connection, schema, filter_names, **kw
+        )
+
+    def get_multi_indexes(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        return self._default_multi_reflect(
+            self.get_indexes, connection, schema, filter_names, **kw
+        )
+
+    def get_multi_unique_constraints(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        return self._default_multi_reflect(
+            self.get_unique_constraints, connection, schema, filter_names, **kw
+        )
+
+    def get_multi_check_constraints(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        return self._default_multi_reflect(
+            self.get_check_constraints, connection, schema, filter_names, **kw
+        )
+
+    def get_multi_table_comment(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        return self._default_multi_reflect(
+            self.get_table_comment, connection, schema, filter_names, **kw
+        )
+
     def has_index(self, connection, table_name, index_name, schema=None):
         if not self.has_table(connection, table_name, schema=schema):
             return False
@@ -545,6 +618,12 @@ class DefaultDialect(interfaces.Dialect):
         else:
             return True
 
+    def get_schema_version(self, connection):
+        return None
+
+    def get_replication_lag(self, dbapi_connection):
+        return None
+
     def create_xid(self):
         """Create a random two-phase transaction ID.
 
@@ -572,6 +651,14 @@ class DefaultDialect(interfaces.Dialect):
     def do_execute_no_params(self, cursor, statement, context=None):
         cursor.execute(statement)
 
+    def do_execute_batch(self, batch):
+        rowcounts = []
+        for statement, parameters, context in batch:
+            cursor = context.cursor
+            cursor.execute(statement, parameters)
+            rowcounts.append(cursor.rowcount)
+        return rowcounts
+
     def is_disconnect(self, e, connection, cursor):
         return False
 
@@ -863,6 +950,9 @@ class DefaultExecutionContext(interfaces.ExecutionContext):
 
         replacement_expressions = {}
         to_update_sets = {}
+        pad_expanding = self.execution_options.get(
+            "expanding_in_padding", self.dialect.expanding_in_padding
+        )
 
         for name in (
             compiled.positiontup
@@ -891,6 +981,12 @@ class DefaultExecutionContext(interfaces.ExecutionContext):
                     # individual numbered parameters for each value in the
                     # param.
                     values = compiled_params.pop(name)
+                    if pad_expanding and values and not parameter.literal_execute:
+                        # repeat the last value up to a power of two so that
+                        # the statement only varies with the bucket size
+                        values = list(values)
+                        size = 1 << (len(values) - 1).bit_length()
+                        values.extend([values[-1]] * (size - len(values)))
 
                     leep = compiled._literal_execute_expanding_parameter
                     to_update, replacement_expr = leep(name, parameter, values)
@@ -408,6 +408,95 @@ class Dialect(object):
 
         raise NotImplementedError()
 
+    def get_multi_columns(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        """Return information about the columns of all tables in `schema`,
+        or of the tables and views named in `filter_names`, as a dictionary
+        mapping table names to the lists returned by :meth:`.get_columns`.
+
+        Dialects retrieve them with as few queries as possible, rather than
+        one per table.  The other ``get_multi_*`` methods do the same for
+        the corresponding ``get_*`` methods.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
+    def get_multi_pk_constraint(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        """Return the results of :meth:`.get_pk_constraint` for all tables
+        of `schema`, see :meth:`.get_multi_columns`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
+    def get_multi_foreign_keys(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        """Return the results of :meth:`.get_foreign_keys` for all tables
+        of `schema`, see :meth:`.get_multi_columns`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
+    def get_multi_indexes(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        """Return the results of :meth:`.get_indexes` for all tables
+        of `schema`, see :meth:`.get_multi_columns`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
+    def get_multi_unique_constraints(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        """Return the results of :meth:`.get_unique_constraints` for all tables
+        of `schema`, see :meth:`.get_multi_columns`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
+    def get_multi_check_constraints(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        """Return the results of :meth:`.get_check_constraints` for all tables
+        of `schema`, see :meth:`.get_multi_columns`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
+    def get_multi_table_comment(
+        self, connection, schema=None, filter_names=None, **kw
+    ):
+        """Return the results of :meth:`.get_table_comment` for all tables
+        of `schema`, see :meth:`.get_multi_columns`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
     def normalize_name(self, name):
         """convert the given name to lowercase if it is detected as
         case insensitive.
@@ -659,6 +748,18 @@ class Dialect(object):
 
         raise NotImplementedError()
 
+    def do_execute_batch(self, batch):
+        """Execute a batch of ``(statement, parameters, context)`` tuples,
+        each on the cursor of its context, and return a list with the
+        rowcount of each.
+
+        Used by :meth:`.Connection.execute_batch`; dialects may send the
+        batch in fewer round trips.
+
+        """
+
+        raise NotImplementedError()
+
     def do_execute_no_params(
         self, cursor, statement, parameters, context=None
     ):
@@ -773,6 +874,29 @@ class Dialect(object):
 
         raise NotImplementedError()
 
+    def get_schema_version(self, connection):
+        """Return a value changing whenever the schema of the database
+        changes, or None if the database doesn't provide one.
+
+        Keys the files of :class:`.ReflectionCache`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        raise NotImplementedError()
+
+    def get_replication_lag(self, dbapi_conn):
+        """Given a DBAPI connection to a replica, return how far behind its
+        primary it is, in seconds, or None if it can't be determined.
+
+        A connection to a primary returns 0.  Used by
+        :class:`.RoutingEngine` to exclude lagging replicas.
+
+        """
+
+        raise NotImplementedError()
+
     @classmethod
     def get_dialect_cls(cls, url):
         """Given a URL, return the :class:`.Dialect` that will be used.
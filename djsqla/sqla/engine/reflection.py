@@ -25,6 +25,10 @@ methods such as get_table_names, get_columns, etc.
    'name' attribute..
 """
 
+import os
+import pickle
+import tempfile
+
 from .base import Connectable
 from .. import exc
 from .. import inspection
@@ -37,16 +41,20 @@ from ..util import deprecated
 from ..util import topological
 
 
+def _cache_key(fn_name, args, kw):
+    return (
+        fn_name,
+        tuple(a for a in args if isinstance(a, util.string_types)),
+        tuple(sorted((k, v) for k, v in kw.items() if k != "info_cache")),
+    )
+
+
 @util.decorator
 def cache(fn, self, con, *args, **kw):
     info_cache = kw.get("info_cache", None)
     if info_cache is None:
         return fn(self, con, *args, **kw)
-    key = (
-        fn.__name__,
-        tuple(a for a in args if isinstance(a, util.string_types)),
-        tuple((k, v) for k, v in kw.items() if k != "info_cache"),
-    )
+    key = _cache_key(fn.__name__, args, kw)
     ret = info_cache.get(key)
     if ret is None:
         ret = fn(self, con, *args, **kw)
@@ -558,6 +566,168 @@ class Inspector(object):
             self.bind, table_name, schema, info_cache=self.info_cache, **kw
         )
 
+    def _get_multi(self, method_name, schema, filter_names, kw):
+        result = getattr(self.dialect, "get_multi_" + method_name[4:])(
+            self.bind,
+            schema,
+            filter_names,
+            info_cache=self.info_cache,
+            **kw
+        )
+        # later per-table calls, e.g. from reflecttable(), read the cache
+        for table_name, value in result.items():
+            key = _cache_key(method_name, (table_name, schema), kw)
+            self.info_cache[key] = value
+        return result
+
+    def get_multi_columns(self, schema=None, filter_names=None, **kw):
+        """Return information about the columns of all tables and views in
+        a schema, retrieved in as few queries as the dialect allows.
+
+        :param schema: string schema name; if omitted, uses the default schema
+         of the database connection.
+
+        :param filter_names: optional sequence of table names; only these
+         tables are reflected.
+
+        :return: a dictionary mapping table names to the lists returned
+         by :meth:`.Inspector.get_columns`.
+
+        .. versionadded:: 1.4
+
+        """
+
+        columns = self._get_multi("get_columns", schema, filter_names, kw)
+        for col_defs in columns.values():
+            for col_def in col_defs:
+                coltype = col_def["type"]
+                if not isinstance(coltype, TypeEngine):
+                    col_def["type"] = coltype()
+        return columns
+
+    def get_multi_pk_constraint(self, schema=None, filter_names=None, **kw):
+        """Return the primary key constraints of all tables in a schema,
+        as a dictionary mapping table names to the dictionaries returned by
+        :meth:`.Inspector.get_pk_constraint`.
+
+        See :meth:`.Inspector.get_multi_columns` for the arguments.
+
+        .. versionadded:: 1.4
+
+        """
+
+        return self._get_multi("get_pk_constraint", schema, filter_names, kw)
+
+    def get_multi_foreign_keys(self, schema=None, filter_names=None, **kw):
+        """Return the foreign keys of all tables in a schema, as a
+        dictionary mapping table names to the lists returned by
+        :meth:`.Inspector.get_foreign_keys`.
+
+        See :meth:`.Inspector.get_multi_columns` for the arguments.
+
+        .. versionadded:: 1.4
+
+        """
+
+        return self._get_multi("get_foreign_keys", schema, filter_names, kw)
+
+    def get_multi_indexes(self, schema=None, filter_names=None, **kw):
+        """Return the indexes of all tables in a schema, as a dictionary
+        mapping table names to the lists returned by
+        :meth:`.Inspector.get_indexes`.
+
+        See :meth:`.Inspector.get_multi_columns` for the arguments.
+
+        .. versionadded:: 1.4
+
+        """
+
+        return self._get_multi("get_indexes", schema, filter_names, kw)
+
+    def get_multi_unique_constraints(
+        self, schema=None, filter_names=None, **kw
+    ):
+        """Return the unique constraints of all tables in a schema, as a
+        dictionary mapping table names to the lists returned by
+        :meth:`.Inspector.get_unique_constraints`.
+
+        See :meth:`.Inspector.get_multi_columns` for the arguments.
+
+        .. versionadded:: 1.4
+
+        """
+
+        return self._get_multi(
+            "get_unique_constraints", schema, filter_names, kw
+        )
+
+    def get_multi_check_constraints(
+        self, schema=None, filter_names=None, **kw
+    ):
+        """Return the check constraints of all tables in a schema, as a
+        dictionary mapping table names to the lists returned by
+        :meth:`.Inspector.get_check_constraints`.
+
+        See :meth:`.Inspector.get_multi_columns` for the arguments.
+
+        .. versionadded:: 1.4
+
+        """
+
+        return self._get_multi(
+            "get_check_constraints", schema, filter_names, kw
+        )
+
+    def get_multi_table_comment(self, schema=None, filter_names=None, **kw):
+        """Return the comments of all tables in a schema, as a dictionary
+        mapping table names to the dictionaries returned by
+        :meth:`.Inspector.get_table_comment`.
+
+        See :meth:`.Inspector.get_multi_columns` for the arguments.
+
+        .. versionadded:: 1.4
+
+        """
+
+        return self._get_multi("get_table_comment", schema, filter_names, kw)
+
+    def prefetch(self, schema=None, filter_names=None, **kw):
+        """Load everything :meth:`.reflecttable` needs for the tables of a
+        schema with the ``get_multi_*`` methods, one kind at a time, so that
+        reflecting each table reads the cache instead of the database.
+
+        ``kw`` are the dialect arguments the tables will be reflected with.
+        Tables whose columns are cached already are left out, and kinds the
+        dialect can't reflect are skipped.
+
+        .. versionadded:: 1.4
+
+        """
+
+        if filter_names is not None:
+            filter_names = [
+                name
+                for name in filter_names
+                if _cache_key("get_columns", (name, schema), kw)
+                not in self.info_cache
+            ]
+            if not filter_names:
+                return
+        for method, method_kw in (
+            (self.get_multi_columns, kw),
+            (self.get_multi_pk_constraint, kw),
+            (self.get_multi_foreign_keys, kw),
+            # reflecttable() doesn't pass the dialect arguments to these
+            (self.get_multi_indexes, {}),
+            (self.get_multi_unique_constraints, {}),
+            (self.get_multi_check_constraints, {}),
+            (self.get_multi_table_comment, {}),
+        ):
+            try:
+                method(schema, filter_names, **method_kw)
+            except NotImplementedError:
+                pass
+
     def reflecttable(
         self,
         table,
@@ -996,3 +1166,73 @@ class Inspector(object):
             return
         else:
             table.comment = comment_dict.get("text", None)
+
+
+class ReflectionCache(object):
+    """Keeps the reflection information of an :class:`.Inspector` in a
+    pickle file between processes, e.g. to skip reflecting a large schema
+    on every start::
+
+        cache = ReflectionCache("/var/cache/app/reflection.pickle")
+        metadata.reflect(engine, reflection_cache=cache)
+
+    The file is keyed by a schema version, and discarded when the version
+    changes.  The version is given explicitly, e.g. the revision of the
+    latest migration, or else asked to the dialect with
+    :meth:`.Dialect.get_schema_version`.  Nothing is cached if neither
+    provides one.
+
+    .. versionadded:: 1.4
+
+    """
+
+    def __init__(self, path, version=None):
+        self.path = path
+        self.version = version
+
+    def _key(self, bind):
+        version = self.version
+        if version is None:
+            version = bind.dialect.get_schema_version(bind)
+            if version is None:
+                return None
+        return (bind.dialect.name, bind.engine.url.database, version)
+
+    def load(self, inspector):
+        """Fill the cache of ``inspector`` from the file, unless it's
+        missing or stale."""
+        key = self._key(inspector.bind)
+        if key is None:
+            return
+        try:
+            with open(self.path, "rb") as fh:
+                data = pickle.load(fh)
+        except Exception:
+            # missing, unreadable or written by an incompatible version
+            return
+        if isinstance(data, dict) and data.get("key") == key:
+            inspector.info_cache.update(data["info_cache"])
+
+    def save(self, inspector):
+        """Write the cache of ``inspector`` to the file."""
+        key = self._key(inspector.bind)
+        if key is None:
+            return
+        try:
+            payload = pickle.dumps(
+                {"key": key, "info_cache": inspector.info_cache},
+                pickle.HIGHEST_PROTOCOL,
+            )
+        except Exception as err:
+            util.warn("Can't pickle the reflection cache: %s" % err)
+            return
+        directory = os.path.dirname(os.path.abspath(self.path))
+        # write atomically, processes may load the file concurrently
+        fd, tmp_path = tempfile.mkstemp(dir=directory, prefix=".reflection-")
+        try:
+            with os.fdopen(fd, "wb") as fh:
+                fh.write(payload)
+            getattr(os, "replace", os.rename)(tmp_path, self.path)
+        except OSError:
+            if os.path.exists(tmp_path):
+                os.remove(tmp_path)
@@ -10,6 +10,10 @@ to invoke them for a create/drop call.
 
 """
 
+import collections
+import copy
+import sys
+
 from . import roles
 from .base import _bind_or_error
 from .base import _generative
@@ -588,8 +592,69 @@ class DropColumnComment(_CreateDropBase):
 
 
 class DDLBase(SchemaVisitor):
-    def __init__(self, connection):
+    def __init__(self, connection, concurrency=1):
         self.connection = connection
+        self.concurrency = concurrency
+
+    @util.dependencies("sqlalchemy.pool")
+    def _get_concurrent_engine(self, pool):
+        """Return the engine to open the connections of concurrent DDL
+        from, or None if the DDL has to run on this connection."""
+        # without ALTER, foreign keys can't be kept out of the concurrent
+        # statements; such backends, e.g. SQLite, mostly lock the whole
+        # database anyway
+        if self.concurrency <= 1 or not self.dialect.supports_alter:
+            return None
+        # other connections only see what this one committed, and mock
+        # connections have none to give
+        in_transaction = getattr(self.connection, "in_transaction", None)
+        if in_transaction is None or in_transaction():
+            return None
+        engine = self.connection.engine
+        # these pools hand the same connection, or database, to everyone
+        if isinstance(
+            engine.pool, (pool.SingletonThreadPool, pool.StaticPool)
+        ):
+            return None
+        return engine
+
+    def _run_concurrently(self, engine, items, fn):
+        """Call ``fn(visitor, item)`` for each of ``items``, over up to
+        ``concurrency`` connections of ``engine``, where ``visitor`` is a
+        copy of this visitor using one of them.  The first error is
+        re-raised once all calls stopped."""
+        if len(items) <= 1:
+            for item in items:
+                fn(self, item)
+            return
+
+        pending = collections.deque(items)
+        errors = []
+
+        def work():
+            try:
+                with engine.connect() as connection:
+                    visitor = copy.copy(self)
+                    visitor.connection = connection
+                    while not errors:
+                        try:
+                            item = pending.popleft()
+                        except IndexError:
+                            return
+                        fn(visitor, item)
+            except BaseException:
+                errors.append(sys.exc_info())
+
+        workers = [
+            util.threading.Thread(target=work)
+            for i in range(min(self.concurrency, len(items)))
+        ]
+        for worker in workers:
+            worker.start()
+        for worker in workers:
+            worker.join()
+        if errors:
+            util.reraise(*errors[0])
 
 
 class SchemaGenerator(DDLBase):
@@ -642,9 +707,23 @@ class SchemaGenerator(DDLBase):
         else:
             tables = list(metadata.tables.values())
 
-        collection = sort_tables_and_constraints(
-            [t for t in tables if self._can_create_table(t)]
+        engine = self._get_concurrent_engine()
+        if engine is not None:
+            # add all foreign keys once the tables exist, leaving the
+            # tables independent of each other
+            def filter_fn(constraint):
+                return True
+
+        else:
+            filter_fn = None
+
+        tiers, remaining_fkcs = _sort_tables_in_tiers(
+            [t for t in tables if self._can_create_table(t)],
+            filter_fn=filter_fn,
         )
+        collection = [item for tier in tiers for item in tier] + [
+            (None, list(remaining_fkcs))
+        ]
 
         seq_coll = [
             s
@@ -664,17 +743,18 @@ class SchemaGenerator(DDLBase):
         for seq in seq_coll:
             self.traverse_single(seq, create_ok=True)
 
-        for table, fkcs in collection:
-            if table is not None:
-                self.traverse_single(
-                    table,
-                    create_ok=True,
-                    include_foreign_key_constraints=fkcs,
-                    _is_metadata_operation=True,
-                )
-            else:
-                for fkc in fkcs:
-                    self.traverse_single(fkc)
+        if engine is not None:
+            for tier in tiers:
+                self._run_concurrently(engine, tier, _create_table)
+            for fkc in remaining_fkcs:
+                self.traverse_single(fkc)
+        else:
+            for table, fkcs in collection:
+                if table is not None:
+                    _create_table(self, (table, fkcs))
+                else:
+                    for fkc in fkcs:
+                        self.traverse_single(fkc)
 
         metadata.dispatch.after_create(
             metadata,
@@ -773,17 +853,36 @@ class SchemaDropper(DDLBase):
         else:
             tables = list(metadata.tables.values())
 
+        engine = self._get_concurrent_engine()
+
         try:
             unsorted_tables = [t for t in tables if self._can_drop_table(t)]
+            if engine is not None and any(
+                fkc.name is None
+                for table in unsorted_tables
+                for fkc in table.foreign_key_constraints
+            ):
+                # DROP TABLE locks the tables the foreign keys refer to;
+                # concurrent drops would take these locks in any order and
+                # deadlock, and unnamed foreign keys can't be dropped first
+                engine = None
+
+            def filter_fn(constraint):
+                if not self.dialect.supports_alter or constraint.name is None:
+                    return False
+                elif engine is not None:
+                    # drop all foreign keys first, one at a time
+                    return True
+                else:
+                    return None
+
+            tiers, remaining_fkcs = _sort_tables_in_tiers(
+                unsorted_tables, filter_fn=filter_fn
+            )
             collection = list(
                 reversed(
-                    sort_tables_and_constraints(
-                        unsorted_tables,
-                        filter_fn=lambda constraint: False
-                        if not self.dialect.supports_alter
-                        or constraint.name is None
-                        else None,
-                    )
+                    [item for tier in tiers for item in tier]
+                    + [(None, list(remaining_fkcs))]
                 )
             )
         except exc.CircularDependencyError as err2:
@@ -800,6 +899,7 @@ class SchemaDropper(DDLBase):
                     % (", ".join(sorted([t.fullname for t in err2.cycles])))
                 )
                 collection = [(t, ()) for t in unsorted_tables]
+                tiers = None
             else:
                 util.raise_from_cause(
                     exc.CircularDependencyError(
@@ -837,14 +937,18 @@ class SchemaDropper(DDLBase):
             _ddl_runner=self,
         )
 
-        for table, fkcs in collection:
-            if table is not None:
-                self.traverse_single(
-                    table, drop_ok=True, _is_metadata_operation=True
-                )
-            else:
-                for fkc in fkcs:
-                    self.traverse_single(fkc)
+        if engine is not None and tiers is not None:
+            for fkc in remaining_fkcs:
+                self.traverse_single(fkc)
+            for tier in reversed(tiers):
+                self._run_concurrently(engine, tier, _drop_table)
+        else:
+            for table, fkcs in collection:
+                if table is not None:
+                    _drop_table(self, (table, fkcs))
+                else:
+                    for fkc in fkcs:
+                        self.traverse_single(fkc)
 
         for seq in seq_coll:
             self.traverse_single(seq, drop_ok=True)
@@ -938,6 +1042,21 @@ class SchemaDropper(DDLBase):
         self.connection.execute(DropSequence(sequence))
 
 
+def _create_table(visitor, item):
+    table, fkcs = item
+    visitor.traverse_single(
+        table,
+        create_ok=True,
+        include_foreign_key_constraints=fkcs,
+        _is_metadata_operation=True,
+    )
+
+
+def _drop_table(visitor, item):
+    table, fkcs = item
+    visitor.traverse_single(table, drop_ok=True, _is_metadata_operation=True)
+
+
 def sort_tables(tables, skip_fn=None, extra_dependencies=None):
     """sort a collection of :class:`.Table` objects based on dependency.
 
@@ -1043,6 +1162,20 @@ def sort_tables_and_constraints(
 
     """
 
+    tiers, remaining_fkcs = _sort_tables_in_tiers(
+        tables, filter_fn, extra_dependencies
+    )
+    return [item for tier in tiers for item in tier] + [
+        (None, list(remaining_fkcs))
+    ]
+
+
+def _sort_tables_in_tiers(tables, filter_fn=None, extra_dependencies=None):
+    """Sort tables as :func:`.sort_tables_and_constraints` does, returning
+    the dependency tiers of ``(Table, [ForeignKeyConstraint, ...])`` tuples,
+    the tables of each tier being independent of each other, and the set
+    of remaining :class:`.ForeignKeyConstraint` objects."""
+
     fixed_dependencies = set()
     mutable_dependencies = set()
 
@@ -1073,7 +1206,7 @@ def sort_tables_and_constraints(
 
     try:
         candidate_sort = list(
-            topological.sort(
+            topological.sort_as_subsets(
                 fixed_dependencies.union(mutable_dependencies),
                 tables,
                 deterministic_order=True,
@@ -1083,6 +1216,8 @@ def sort_tables_and_constraints(
         for edge in err.edges:
             if edge in mutable_dependencies:
                 table = edge[1]
+                if table not in err.cycles:
+                    continue
                 can_remove = [
                     fkc
                     for fkc in table.foreign_key_constraints
@@ -1094,14 +1229,23 @@ def sort_tables_and_constraints(
                     if dependent_on is not table:
                         mutable_dependencies.discard((dependent_on, table))
         candidate_sort = list(
-            topological.sort(
+            topological.sort_as_subsets(
                 fixed_dependencies.union(mutable_dependencies),
                 tables,
                 deterministic_order=True,
             )
         )
 
-    return [
-        (table, table.foreign_key_constraints.difference(remaining_fkcs))
-        for table in candidate_sort
-    ] + [(None, list(remaining_fkcs))]
+    return (
+        [
+            [
+                (
+                    table,
+                    table.foreign_key_constraints.difference(remaining_fkcs),
+                )
+                for table in tier
+            ]
+            for tier in candidate_sort
+        ],
+        remaining_fkcs,
+    )
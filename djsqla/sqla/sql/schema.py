@@ -4032,6 +4032,7 @@ class MetaData(SchemaItem):
         extend_existing=False,
         autoload_replace=True,
         resolve_fks=True,
+        reflection_cache=None,
         **dialect_kwargs
     ):
         r"""Load all available table definitions from the database.
@@ -4098,6 +4099,12 @@ class MetaData(SchemaItem):
 
             :paramref:`.Table.resolve_fks`
 
+        :param reflection_cache: Optional :class:`.ReflectionCache`, which
+         keeps the reflected information in a file for later calls, as long
+         as the schema version is unchanged.
+
+         .. versionadded:: 1.4
+
         :param \**dialect_kwargs: Additional keyword arguments not mentioned
          above are dialect specific, and passed in the form
          ``<dialectname>_<argname>``.  See the documentation regarding an
@@ -4109,12 +4116,18 @@ class MetaData(SchemaItem):
              dialect-level reflection options for all :class:`.Table`
              objects reflected.
 
+        The tables to load are reflected in bulk, one catalog query per
+        kind of information where the dialect supports it, see
+        :meth:`.Inspector.prefetch`.
+
         """
         if bind is None:
             bind = _bind_or_error(self)
 
         with bind.connect() as conn:
             insp = inspection.inspect(conn)
+            if reflection_cache is not None:
+                reflection_cache.load(insp)
 
             reflect_opts = {
                 "autoload_with": insp,
@@ -4172,13 +4185,21 @@ class MetaData(SchemaItem):
                     if extend_existing or name not in current
                 ]
 
+            if len(load) > 1:
+                insp.prefetch(schema, load, **dialect_kwargs)
+
             for name in load:
                 try:
                     Table(name, self, **reflect_opts)
                 except exc.UnreflectableTableError as uerr:
                     util.warn("Skipping table %s: %s" % (name, uerr))
 
-    def create_all(self, bind=None, tables=None, checkfirst=True):
+            if reflection_cache is not None:
+                reflection_cache.save(insp)
+
+    def create_all(
+        self, bind=None, tables=None, checkfirst=True, concurrency=1
+    ):
         """Create all tables stored in this metadata.
 
         Conditional by default, will not attempt to recreate tables already
@@ -4197,14 +4218,29 @@ class MetaData(SchemaItem):
           Defaults to True, don't issue CREATEs for tables already present
           in the target database.
 
+        :param concurrency:
+          Number of connections of the :class:`.Engine` over which to
+          create the tables concurrently.  Foreign key constraints are then
+          added once all tables are created, so that the tables don't
+          depend on each other.  Ignored when the backend doesn't support
+          ALTER, when ``bind`` is a :class:`.Connection` in a transaction,
+          or when the pool of the engine doesn't hand out separate
+          connections.
+
+          .. versionadded:: 1.4
+
         """
         if bind is None:
             bind = _bind_or_error(self)
         bind._run_ddl_visitor(
-            ddl.SchemaGenerator, self, checkfirst=checkfirst, tables=tables
+            ddl.SchemaGenerator,
+            self,
+            checkfirst=checkfirst,
+            tables=tables,
+            concurrency=concurrency,
         )
 
-    def drop_all(self, bind=None, tables=None, checkfirst=True):
+    def drop_all(self, bind=None, tables=None, checkfirst=True, concurrency=1):
         """Drop all tables stored in this metadata.
 
         Conditional by default, will not attempt to drop tables not present in
@@ -4223,11 +4259,24 @@ class MetaData(SchemaItem):
           Defaults to True, only issue DROPs for tables confirmed to be
           present in the target database.
 
+        :param concurrency:
+          Number of connections of the :class:`.Engine` over which to drop
+          the tables concurrently, once their foreign key constraints are
+          dropped one at a time.  Ignored as for
+          :meth:`.MetaData.create_all`, and when a foreign key constraint
+          has no name.
+
+          .. versionadded:: 1.4
+
         """
         if bind is None:
             bind = _bind_or_error(self)
         bind._run_ddl_visitor(
-            ddl.SchemaDropper, self, checkfirst=checkfirst, tables=tables
+            ddl.SchemaDropper,
+            self,
+            checkfirst=checkfirst,
+            tables=tables,
+            concurrency=concurrency,
         )
 
 
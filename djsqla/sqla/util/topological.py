@@ -15,6 +15,12 @@ __all__ = ["sort", "sort_as_subsets", "find_cycles"]
 
 
 def sort_as_subsets(tuples, allitems, deterministic_order=False):
+    """Yield the items of ``allitems`` in dependency tiers, each tier being
+    a set of items that depend only on items of earlier tiers.
+
+    Kahn's algorithm, in O(V + E): each item is assigned the tier after
+    that of its last parent, and tiers are filled in ``allitems`` order.
+    """
 
     edges = util.defaultdict(set)
     for parent, child in tuples:
@@ -24,22 +30,43 @@ def sort_as_subsets(tuples, allitems, deterministic_order=False):
 
     todo = Set(allitems)
 
-    while todo:
-        output = Set()
-        for node in todo:
-            if todo.isdisjoint(edges[node]):
-                output.add(node)
-
-        if not output:
-            raise CircularDependencyError(
-                "Circular dependency detected.",
-                find_cycles(tuples, allitems),
-                _gen_edges(edges),
-            )
-
-        todo.difference_update(output)
+    children = util.defaultdict(list)
+    pending = {}
+    for node in todo:
+        parents = [parent for parent in edges[node] if parent in todo]
+        pending[node] = len(parents)
+        for parent in parents:
+            children[parent].append(node)
+
+    tier_of = {}
+    current = [node for node in todo if not pending[node]]
+    tier = 0
+    while current:
+        following = []
+        for node in current:
+            tier_of[node] = tier
+            for child in children[node]:
+                pending[child] -= 1
+                if not pending[child]:
+                    following.append(child)
+        current = following
+        tier += 1
+
+    tiers = [Set() for i in range(tier)]
+    for node in todo:
+        if node in tier_of:
+            tiers[tier_of[node]].add(node)
+
+    for output in tiers:
         yield output
 
+    if len(tier_of) < len(todo):
+        raise CircularDependencyError(
+            "Circular dependency detected.",
+            find_cycles(tuples, allitems),
+            _gen_edges(edges),
+        )
+
 
 def sort(tuples, allitems, deterministic_order=False):
     """sort the given list of items by dependency.
@@ -54,42 +81,59 @@ def sort(tuples, allitems, deterministic_order=False):
 
 
 def find_cycles(tuples, allitems):
-    # adapted from:
-    # http://neopythonic.blogspot.com/2009/01/detecting-cycles-in-directed-graph.html
+    """Return the set of nodes involved in cycles.
+
+    These are the nodes of the strongly connected components with more
+    than one node, plus those depending on themselves, found with an
+    iterative version of Tarjan's algorithm in O(V + E).
+    """
 
     edges = util.defaultdict(set)
     for parent, child in tuples:
         edges[parent].add(child)
-    nodes_to_test = set(edges)
 
     output = set()
 
-    # we'd like to find all nodes that are
-    # involved in cycles, so we do the full
-    # pass through the whole thing for each
-    # node in the original list.
-
-    # we can go just through parent edge nodes.
-    # if a node is only a child and never a parent,
-    # by definition it can't be part of a cycle.  same
-    # if it's not in the edges at all.
-    for node in nodes_to_test:
-        stack = [node]
-        todo = nodes_to_test.difference(stack)
-        while stack:
-            top = stack[-1]
-            for node in edges[top]:
-                if node in stack:
-                    cyc = stack[stack.index(node) :]
-                    todo.difference_update(cyc)
-                    output.update(cyc)
-
-                if node in todo:
-                    stack.append(node)
-                    todo.remove(node)
+    index = {}
+    lowlink = {}
+    stack = []
+    on_stack = set()
+
+    # a node which is only a child and never a parent can't be part of a
+    # cycle, so we only start from parents.
+    for root in list(edges):
+        if root in index:
+            continue
+        index[root] = lowlink[root] = len(index)
+        stack.append(root)
+        on_stack.add(root)
+        path = [(root, iter(edges[root]))]
+        while path:
+            node, node_children = path[-1]
+            for child in node_children:
+                if child not in index:
+                    index[child] = lowlink[child] = len(index)
+                    stack.append(child)
+                    on_stack.add(child)
+                    path.append((child, iter(edges.get(child, ()))))
                     break
+                elif child in on_stack:
+                    lowlink[node] = min(lowlink[node], index[child])
             else:
-                node = stack.pop()
+                path.pop()
+                if path:
+                    parent = path[-1][0]
+                    lowlink[parent] = min(lowlink[parent], lowlink[node])
+                if lowlink[node] == index[node]:
+                    component = []
+                    while True:
+                        member = stack.pop()
+                        on_stack.discard(member)
+                        component.append(member)
+                        if member is node:
+                            break
+                    if len(component) > 1 or node in edges.get(node, ()):
+                        output.update(component)
     return output
 
 